@@ -0,0 +1,142 @@
+#include "adr_engine.h"
+#include <string.h>
+
+AdrEngine::AdrEngine() {
+    memset(nodes, 0, sizeof(nodes));
+}
+
+int16_t AdrEngine::demodulationFloor(int sf) {
+    // SX127x required SNR in 0.25 dB: -7.5 dB at SF7, 2.5 dB lower per SF step
+    return -30 - 10 * (sf - 7);
+}
+
+AdrEngine::NodeLink* AdrEngine::findNode(uint8_t address, const LoraParams& base) {
+    NodeLink* freeSlot = nullptr;
+    for (uint8_t i = 0; i < ADR_MAX_NODES; i++) {
+        if (nodes[i].used && nodes[i].address == address) return &nodes[i];
+        if (!nodes[i].used && !freeSlot) freeSlot = &nodes[i];
+    }
+    if (!freeSlot) return nullptr;  // Table full: node keeps its current settings
+
+    memset(freeSlot, 0, sizeof(NodeLink));
+    freeSlot->used = true;
+    freeSlot->address = address;
+    freeSlot->tp = base.tp;
+    return freeSlot;
+}
+
+const AdrEngine::NodeLink* AdrEngine::findNode(uint8_t address) const {
+    for (uint8_t i = 0; i < ADR_MAX_NODES; i++) {
+        if (nodes[i].used && nodes[i].address == address) return &nodes[i];
+    }
+    return nullptr;
+}
+
+void AdrEngine::recordUplink(uint8_t address, float snr, int rssi, const LoraParams& base) {
+    NodeLink* node = findNode(address, base);
+    if (!node) return;
+
+    // Packet SNR comes in 0.25 dB steps from -32 to +31.75 dB, so it fits an int8 exactly
+    int16_t quarters = (int16_t)(snr * 4.0f);
+    if (quarters > INT8_MAX) quarters = INT8_MAX;
+    if (quarters < INT8_MIN) quarters = INT8_MIN;
+    node->snr[node->head] = (int8_t)quarters;
+    node->rssiLoss[node->head] = (rssi >= 0) ? 0 : (rssi <= -255 ? 255 : (uint8_t)-rssi);
+    node->head = (node->head + 1) % ADR_HISTORY_LEN;
+    if (node->count < ADR_HISTORY_LEN) node->count++;
+}
+
+int16_t AdrEngine::linkMargin(uint8_t address, int sf) const {
+    const NodeLink* node = findNode(address);
+    if (!node || node->count == 0) return 0;
+
+    // Best SNR in the window, as in LoRaWAN ADR: fading dips are absorbed by the installation margin
+    int16_t maxSnr = node->snr[0];
+    for (uint8_t i = 1; i < node->count; i++) {
+        if (node->snr[i] > maxSnr) maxSnr = node->snr[i];
+    }
+    return maxSnr - demodulationFloor(sf) - 4 * ADR_INSTALLATION_MARGIN_DB;
+}
+
+int AdrEngine::averageRssi(uint8_t address) const {
+    const NodeLink* node = findNode(address);
+    if (!node || node->count == 0) return 0;
+
+    long sum = 0;
+    for (uint8_t i = 0; i < node->count; i++) sum += node->rssiLoss[i];
+    return -(int)(sum / node->count);
+}
+
+bool AdrEngine::computeParams(uint8_t address, const LoraParams& base, LoraParams& out) {
+    out = base;
+    NodeLink* node = findNode(address, base);
+    if (!node) return false;
+
+    out.tp = node->tp;
+    if (node->pending) return false;  // Margin is only meaningful once the last change is in effect
+
+    int steps = 0;
+    if (node->count > 0) {
+        int16_t margin = linkMargin(address, base.sf);
+        steps = margin / (4 * ADR_STEP_DB);  // Truncates towards zero
+
+        // Stepping down needs a full window; stepping up reacts after half of it
+        if (steps > 0 && node->count < ADR_HISTORY_LEN) steps = 0;
+        if (steps < 0 && node->count < ADR_HISTORY_LEN / 2) steps = 0;
+    }
+
+    // Headroom: lower TX power; margin short: raise it
+    while (steps > 0 && out.tp > ADR_MIN_TP) {
+        out.tp -= ADR_TP_STEP;
+        if (out.tp < ADR_MIN_TP) out.tp = ADR_MIN_TP;
+        steps--;
+    }
+    while (steps < 0 && out.tp < ADR_MAX_TP) {
+        out.tp = adrRaisePower(out.tp);
+        steps++;
+    }
+
+    if (out.tp == node->tp) return false;
+
+    // Keep the confirmed TX power until the node acks
+    node->pending = true;
+    return true;
+}
+
+void AdrEngine::confirmParams(uint8_t address, const LoraParams& applied) {
+    NodeLink* node = findNode(address, applied);
+    if (!node) return;
+
+    // Old measurements describe the previous settings; start a fresh window
+    node->tp = applied.tp;
+    node->pending = false;
+    node->head = 0;
+    node->count = 0;
+}
+
+void AdrEngine::confirmFail(uint8_t address, const LoraParams& base) {
+    NodeLink* node = findNode(address, base);
+    if (!node) return;
+
+    node->tp = adrRaisePower(node->tp);
+    node->head = 0;
+    node->count = 0;
+}
+
+void AdrEngine::cancelPending(uint8_t address) {
+    for (uint8_t i = 0; i < ADR_MAX_NODES; i++) {
+        if (nodes[i].used && nodes[i].address == address) {
+            nodes[i].pending = false;
+            return;
+        }
+    }
+}
+
+void AdrEngine::resetNode(uint8_t address) {
+    for (uint8_t i = 0; i < ADR_MAX_NODES; i++) {
+        if (nodes[i].used && nodes[i].address == address) {
+            memset(&nodes[i], 0, sizeof(NodeLink));
+            return;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef ADR_ENGINE_H
+#define ADR_ENGINE_H
+
+#include <stdint.h>
+#include "lora_params.h"
+#include "node_limits.h"
+
+// ----- ADR Configuration -----
+#ifndef ADR_MAX_NODES
+#define ADR_MAX_NODES CENTRAL_MAX_NODES  // Nodes tracked by the central node
+#endif
+
+#ifndef ADR_HISTORY_LEN
+#define ADR_HISTORY_LEN 8             // Uplinks kept per node before stepping down
+#endif
+
+#ifndef ADR_INSTALLATION_MARGIN_DB
+#define ADR_INSTALLATION_MARGIN_DB 10  // Safety margin kept above the demodulation floor
+#endif
+
+#define ADR_STEP_DB 3                 // dB of margin traded per TP step
+#define ADR_MIN_TP 2
+#define ADR_MAX_TP 20
+#define ADR_TP_STEP 3                 // dBm per TX power step
+
+// One TX power step up, capped at ADR_MAX_TP (also how a node answers SENDFAIL)
+inline int adrRaisePower(int tp) {
+    return (tp + ADR_TP_STEP > ADR_MAX_TP) ? ADR_MAX_TP : tp + ADR_TP_STEP;
+}
+
+// Central-node adaptive data rate engine, TX power only.
+// Keeps a short SNR/RSSI history per node and moves each node towards the
+// lowest TX power that still leaves ADR_INSTALLATION_MARGIN_DB of link margin.
+// The central's single radio listens on one SF and is never retuned, so SF/BW
+// are not adapted: a node moved off the central's SF could not be heard again.
+class AdrEngine {
+private:
+    struct NodeLink {
+        bool used;
+        uint8_t address;
+        int8_t snr[ADR_HISTORY_LEN];    // Ring buffer of packet SNR, 0.25 dB (SX127x resolution)
+        uint8_t rssiLoss[ADR_HISTORY_LEN];  // Ring buffer of -RSSI (dBm); RSSI is never positive
+        uint8_t head;
+        uint8_t count;
+        int8_t tp;                      // TX power the node is confirmed to be using
+        bool pending;                   // CONFIG sent, not yet confirmed by an uplink
+    };
+
+    NodeLink nodes[ADR_MAX_NODES];
+
+    NodeLink* findNode(uint8_t address, const LoraParams& base);
+    const NodeLink* findNode(uint8_t address) const;
+    static int16_t demodulationFloor(int sf);
+
+public:
+    AdrEngine();
+
+    // Record link quality of an uplink received from a node
+    void recordUplink(uint8_t address, float snr, int rssi, const LoraParams& base);
+
+    // Link margin above the demodulation floor at 'sf' in 0.25 dB units, or 0 if no history
+    int16_t linkMargin(uint8_t address, int sf) const;
+    int averageRssi(uint8_t address) const;
+
+    // Fill 'out' with base params and the node's new TX power; returns true if a CONFIG push is needed.
+    // No further change is proposed until confirmParams() reports the previous one applied.
+    bool computeParams(uint8_t address, const LoraParams& base, LoraParams& out);
+
+    // Node acknowledged 'applied' from an uplink sent on those settings
+    void confirmParams(uint8_t address, const LoraParams& applied);
+    // The proposed change could not be queued; allow computeParams() to propose again
+    void cancelPending(uint8_t address);
+    // Node acknowledged a SENDFAIL, i.e. raised its TX power one step
+    void confirmFail(uint8_t address, const LoraParams& base);
+
+    void resetNode(uint8_t address);
+};
+
+#endif
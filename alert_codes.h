@@ -0,0 +1,46 @@
+#ifndef ALERT_CODES_H
+#define ALERT_CODES_H
+
+#include <stdint.h>
+#include "sensor_data.h"
+#include "thresholds.h"
+
+// Alert bit definitions for 16-bit alert code
+#define ALERT_NONE                0x0000
+#define ALERT_LOW_TEMP            0x0001
+#define ALERT_HIGH_TEMP           0x0002
+#define ALERT_LOW_HUMIDITY        0x0004
+#define ALERT_HIGH_HUMIDITY       0x0008
+#define ALERT_LOW_SOIL_MOISTURE   0x0010
+#define ALERT_HIGH_SOIL_MOISTURE  0x0020
+#define ALERT_LOW_BATTERY         0x0040
+#define ALERT_SENSOR_FAILURE      0x0080
+#define ALERT_COMM_FAILURE        0x0100
+#define ALERT_CONFIG_ERROR        0x0200
+#define ALERT_LOW_SIGNAL          0x0400
+#define ALERT_MULTIPLE            0x0800
+#define ALERT_PREDICTED           0x1000  // Set with the bits of thresholds forecast to be crossed
+// Reserved bits: 0x2000, 0x4000, 0x8000 for future use
+
+// Compare a reading against thresholds (both in fixed-point units, integer compares only)
+inline uint16_t evaluateThresholds(const SensorData& data, const Thresholds& th) {
+    uint16_t alertCode = ALERT_NONE;
+
+    if (data.temperature == SENSOR_INVALID || data.humidity == SENSOR_INVALID) {
+        alertCode |= ALERT_SENSOR_FAILURE;
+    }
+    if (data.temperature != SENSOR_INVALID) {
+        if (data.temperature < th.lowTemperature) alertCode |= ALERT_LOW_TEMP;
+        else if (data.temperature > th.highTemperature) alertCode |= ALERT_HIGH_TEMP;
+    }
+    if (data.humidity != SENSOR_INVALID) {
+        if (data.humidity < th.lowHumidity) alertCode |= ALERT_LOW_HUMIDITY;
+        else if (data.humidity > th.highHumidity) alertCode |= ALERT_HIGH_HUMIDITY;
+    }
+    if (data.soilMoisture < th.lowSoilMoisture) alertCode |= ALERT_LOW_SOIL_MOISTURE;
+    else if (data.soilMoisture > th.highSoilMoisture) alertCode |= ALERT_HIGH_SOIL_MOISTURE;
+
+    return alertCode;
+}
+
+#endif
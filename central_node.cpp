@@ -0,0 +1,87 @@
+#include "central_node.h"
+
+void CentralNode::runAdr(const byte &node_address){
+    LoraParams params;
+    if (adr.computeParams(node_address, configManager.getParams(), params) &&
+        !downlinks.queueParams(node_address, params)) {
+        adr.cancelPending(node_address);  // No ack can come for a CONFIG that was never queued (table full)
+    }
+}
+
+void CentralNode::runTrends(const byte &node_address, unsigned long rxTime){
+    predictedAlertCode = trends.update(node_address, sensorData, configManager.getThresholds(), rxTime);
+
+    // Sample densely only where conditions are moving towards a threshold
+    if (CENTRAL_DENSE_INTERVAL_S == 0) return;
+    uint16_t wanted = trends.wantsDense(node_address) ? CENTRAL_DENSE_INTERVAL_S : CENTRAL_NORMAL_INTERVAL_S;
+
+    // Compare against what the node will run once the queue drains; re-queue until it acks
+    uint16_t queued;
+    if (!downlinks.queuedInterval(node_address, queued)) {
+        queued = trends.isDense(node_address) ? CENTRAL_DENSE_INTERVAL_S : CENTRAL_NORMAL_INTERVAL_S;
+    }
+    if (queued != wanted) downlinks.queueInterval(node_address, wanted);
+}
+
+void CentralNode::onDelivered(const byte &node_address, const DownlinkBatch& delivered){
+    // The acking uplink was sent on the new settings, so ADR may measure against them now
+    if (delivered.hasParams) {
+        LoraParams applied = configManager.getParams();
+        radioProfileDecode(delivered.profile, applied);
+        applied.tp = delivered.tp;
+        adr.confirmParams(node_address, applied);
+    }
+    if (delivered.sendFail) adr.confirmFail(node_address, configManager.getParams());  // Applied after CONFIG
+    if (delivered.hasInterval) trends.setDense(node_address, delivered.intervalSeconds == CENTRAL_DENSE_INTERVAL_S);
+}
+
+bool CentralNode::sendDownlink(const byte &node_address, uint8_t applied, unsigned long rxTime){
+    DownlinkBatch batch;
+    uint8_t sequence;
+    if (!downlinks.peek(node_address, applied, batch, sequence)) return false;
+
+    // Node opens RX1 DOWNLINK_RX1_DELAY_MS after its uplink ended
+    unsigned long elapsed = millis() - rxTime;
+    if (elapsed < DOWNLINK_RX1_DELAY_MS) delay(DOWNLINK_RX1_DELAY_MS - elapsed);
+    return sender.sendBatch(batch, sequence, localAddress, node_address, lora);
+}
+
+bool CentralNode::receiveMessage() {
+    PayloadData message = receiver.receiveMessage(localAddress, lora);
+    if (!message.data) return false;
+    unsigned long rxTime = millis();
+
+    LoraReceiver::MessageType messageType = receiver.getMessageType();
+    if (messageType == LoraReceiver::NONE) return false;
+
+    byte node_address = receiver.getSenderAddress();
+    uint8_t applied = 0;  // Last BATCH sequence the node reports having applied
+
+    switch (messageType) {
+        case LoraReceiver::DATA: {
+            // Uplink confirms the last batch the node applied; unconfirmed batches are resent below
+            applied = receiver.decodeAck(message);
+            DownlinkBatch delivered;
+            if (downlinks.acknowledge(node_address, applied, delivered)) {
+                onDelivered(node_address, delivered);
+            }
+
+            receiver.decodeData(message, sensorData);
+            alertCode = evaluateThresholds(sensorData, configManager.getThresholds());
+            runTrends(node_address, rxTime);
+            adr.recordUplink(node_address, receiver.getPacketSnr(), receiver.getPacketRssi(), configManager.getParams());
+            runAdr(node_address);
+            break;
+        }
+
+        default:
+            // CONFIG, THRESHOLDS, SENDFAIL and BATCH are downlinks; ignored by central node
+            break;
+    }
+
+    delete[] message.data;
+
+    // Every uplink opens the node's receive window: send whatever is queued for it
+    if (messageType == LoraReceiver::DATA) sendDownlink(node_address, applied, rxTime);
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef CENTRAL_NODE_H
+#define CENTRAL_NODE_H
+
+#include "lora_receiver.h"
+#include "lora_sender.h"
+#include "Arduino.h"
+#include "config_manager.h"
+#include "adr_engine.h"
+#include "downlink_queue.h"
+#include "trend_estimator.h"
+#include "alert_codes.h"
+#include "sensor_data.h"
+#include "LoRa.h"
+
+#ifndef CENTRAL_DENSE_INTERVAL_S
+#define CENTRAL_DENSE_INTERVAL_S 60    // Interval pushed to nodes with a forecast crossing; 0 disables
+#endif
+#ifndef CENTRAL_NORMAL_INTERVAL_S
+#define CENTRAL_NORMAL_INTERVAL_S LOCAL_REPORT_INTERVAL_S  // Restored once the node calms down
+#endif
+
+class CentralNode{
+    private:
+        LoRaClass lora;
+        LoraReceiver receiver;
+        LoraSender sender;
+        ConfigManager configManager;
+        AdrEngine adr;
+        DownlinkQueue downlinks;
+        TrendEstimator trends;
+        SensorData sensorData;
+        uint16_t alertCode = ALERT_NONE;
+        uint16_t predictedAlertCode = ALERT_NONE;
+        const byte localAddress = CENTRAL_ADDRESS;
+
+        void runAdr(const byte &node_address);
+        void onDelivered(const byte &node_address, const DownlinkBatch& delivered);  // Node acked a batch
+        void runTrends(const byte &node_address, unsigned long rxTime);
+        bool sendDownlink(const byte &node_address, uint8_t applied, unsigned long rxTime);  // Flush queue into node's RX1
+    public:
+        CentralNode() : receiver(), sender(), configManager(), adr(), downlinks(), trends() {
+            lora.begin(configManager.getParams().fr); // Restored from EEPROM (865 MHz for India by default)
+        }
+        bool receiveMessage();
+        // Delivered in the node's receive window after its next uplink
+        bool queueThresholds(const byte &node_address, const Thresholds& th) { return downlinks.queueThresholds(node_address, th); }
+        bool queueFail(const byte &node_address) { return downlinks.queueFail(node_address); }  // Node raises TX power one step
+        const SensorData& getLastSensorData() const { return sensorData; }
+        uint16_t getLastAlertCode() const { return alertCode; }
+        uint16_t getPredictedAlertCode() const { return predictedAlertCode; }  // ALERT_PREDICTED | forecast bits
+};
+
+#endif
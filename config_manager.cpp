@@ -1,9 +1,87 @@
 #include "config_manager.h"
-#include <cmath>
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "radio_profiles.h"
 
-ConfigManager::ConfigManager() {
-    param = getDefaultParams();
-    thresholds = getDefaultThresholds();
+// Q8 fixed-point range multipliers (256 = 1.0) so calculateRange avoids soft-float pow/sqrt
+// 2^((sf - 7) / 2) for SF6..SF12
+static const uint16_t sfRangeQ8[7] PROGMEM = {181, 256, 362, 512, 724, 1024, 1448};
+// sqrt(125 kHz / bw) for each entry of radioBandwidths[]
+static const uint16_t bwRangeQ8[RADIO_NUM_BW] PROGMEM = {1025, 888, 725, 628, 512, 443, 362, 256, 181};
+// 10^((tp - 14) / 20) for 2..20 dBm
+static const uint16_t tpRangeQ8[19] PROGMEM = {64, 72, 81, 91, 102, 114, 128, 144, 162, 181,
+                                               203, 228, 256, 287, 322, 362, 406, 455, 511};
+
+// One slot of the EEPROM ring
+struct StoredConfig {
+    uint8_t version;
+    uint32_t sequence;    // Incremented on every save
+    LoraParams params;
+    Thresholds thresholds;
+    uint16_t crc;         // CRC-16/CCITT over all preceding bytes
+};
+
+static uint16_t crc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static int slotAddress(uint8_t slot) {
+    return CONFIG_STORE_ADDRESS + slot * sizeof(StoredConfig);
+}
+
+ConfigManager::ConfigManager() : storeSlot(CONFIG_STORE_SLOTS - 1), storeSequence(0) {
+    if (!loadStored()) {
+        param = getDefaultParams();
+        thresholds = getDefaultThresholds();
+    }
+}
+
+bool ConfigManager::loadStored() {
+    bool found = false;
+    StoredConfig record;
+    for (uint8_t slot = 0; slot < CONFIG_STORE_SLOTS; slot++) {
+        EEPROM.get(slotAddress(slot), record);
+        if (record.version != CONFIG_STORE_VERSION) continue;
+        if (record.crc != crc16((const uint8_t*)&record, offsetof(StoredConfig, crc))) continue;
+        if (found && record.sequence <= storeSequence) continue;
+        if (!validateParams(record.params) || !validateThresholds(record.thresholds)) continue;
+
+        param = record.params;
+        thresholds = record.thresholds;
+        storeSlot = slot;
+        storeSequence = record.sequence;
+        found = true;
+    }
+    return found;
+}
+
+void ConfigManager::saveStored() {
+    StoredConfig record;
+    memset((void*)&record, 0, sizeof(record));  // Deterministic padding for the CRC
+    record.version = CONFIG_STORE_VERSION;
+    record.params = param;
+    record.thresholds = thresholds;
+
+    // Skip the write if the newest slot already holds this config
+    StoredConfig current;
+    EEPROM.get(slotAddress(storeSlot), current);
+    if (current.version == CONFIG_STORE_VERSION && current.sequence == storeSequence &&
+        memcmp(&current.params, &record.params, sizeof(LoraParams)) == 0 &&
+        memcmp(&current.thresholds, &record.thresholds, sizeof(Thresholds)) == 0) {
+        return;
+    }
+
+    storeSlot = (storeSlot + 1) % CONFIG_STORE_SLOTS;
+    record.sequence = ++storeSequence;
+    record.crc = crc16((const uint8_t*)&record, offsetof(StoredConfig, crc));
+    EEPROM.put(slotAddress(storeSlot), record);  // put() only rewrites bytes that changed
 }
 
 LoraParams ConfigManager::getDefaultParams() {
@@ -21,18 +99,19 @@ LoraParams ConfigManager::getDefaultParams() {
 
 Thresholds ConfigManager::getDefaultThresholds() {
     Thresholds thresholds;
-    thresholds.lowTemperature = 5.0f;    // 5°C minimum
-    thresholds.highTemperature = 35.0f;  // 35°C maximum
-    thresholds.lowHumidity = 30.0f;      // 30% minimum humidity
-    thresholds.highHumidity = 80.0f;     // 80% maximum humidity
-    thresholds.lowSoilMoisture = 200.0f; // Minimum soil moisture (raw ADC: 0-1023)
-    thresholds.highSoilMoisture = 800.0f; // Maximum soil moisture (raw ADC: 0-1023)
+    thresholds.lowTemperature = 50;      // 5.0°C minimum
+    thresholds.highTemperature = 350;    // 35.0°C maximum
+    thresholds.lowHumidity = 300;        // 30.0% minimum humidity
+    thresholds.highHumidity = 800;       // 80.0% maximum humidity
+    thresholds.lowSoilMoisture = 200;    // Minimum soil moisture (raw ADC: 0-1023)
+    thresholds.highSoilMoisture = 800;   // Maximum soil moisture (raw ADC: 0-1023)
     return thresholds;
 }
 
 void ConfigManager::setParams(const LoraParams& params) {
     if (validateParams(params)) {
         param = params;
+        saveStored();
     }
 }
 
@@ -40,7 +119,7 @@ const LoraParams& ConfigManager::getParams() const {
     return param;
 }
 
-LoraParams ConfigManager::getOptimalParamsForRange(float range) {
+LoraParams ConfigManager::getOptimalParamsForRange(uint32_t range) {
     LoraParams params = param;
     
     // Adjust parameters based on required range
@@ -67,6 +146,7 @@ LoraParams ConfigManager::getOptimalParamsForRange(float range) {
 void ConfigManager::setThresholds(const Thresholds& thresholds) {
     if (validateThresholds(thresholds)) {
         this->thresholds = thresholds;
+        saveStored();
     }
 }
 
@@ -75,28 +155,8 @@ const Thresholds& ConfigManager::getThresholds() const {
 }
 
 bool ConfigManager::validateParams(const LoraParams& params) {
-    // Validate frequency (common ISM bands)
-    if (params.fr != 433E6 && params.fr != 865E6 && params.fr != 866E6 && 
-        params.fr != 867E6 && params.fr != 868E6 && params.fr != 915E6) {
-        return false;
-    }
-    
-    // Validate spreading factor
-    if (params.sf < 6 || params.sf > 12) {
-        return false;
-    }
-    
-    // Validate bandwidth
-    if (params.bw != 7.8E3 && params.bw != 10.4E3 && 
-        params.bw != 15.6E3 && params.bw != 20.8E3 && 
-        params.bw != 31.25E3 && params.bw != 41.7E3 && 
-        params.bw != 62.5E3 && params.bw != 125E3 && 
-        params.bw != 250E3) {
-        return false;
-    }
-    
-    // Validate coding rate
-    if (params.cr < 5 || params.cr > 8) {
+    // Frequency, spreading factor, bandwidth and coding rate must form a known radio profile
+    if (radioProfileEncode(params) == RADIO_PROFILE_INVALID) {
         return false;
     }
     
@@ -121,7 +181,7 @@ bool ConfigManager::validateThresholds(const Thresholds& thresholds) {
     
     // Validate humidity thresholds
     if (thresholds.lowHumidity >= thresholds.highHumidity || 
-        thresholds.lowHumidity < 0 || thresholds.highHumidity > 100) {
+        thresholds.lowHumidity < 0 || thresholds.highHumidity > 1000) {
         return false;
     }
     
@@ -137,22 +197,27 @@ bool ConfigManager::validateThresholds(const Thresholds& thresholds) {
 void ConfigManager::resetToDefaults() {
     param = getDefaultParams();
     thresholds = getDefaultThresholds();
+    saveStored();
 }
 
-float ConfigManager::calculateRange(const LoraParams& params) {
+uint32_t ConfigManager::calculateRange(const LoraParams& params) {
     // Simplified range calculation based on LoRa parameters
     // Real-world range depends on many factors (obstacles, antenna, etc.)
-    float baseRange = 1000.0f; // Base range in meters
-    
+    if (params.sf < 6 || params.sf > 12 || params.tp < 2 || params.tp > 20) return 0;
+
+    uint8_t bwIndex = radioBandwidthIndex(params.bw);
+    if (bwIndex == 0xFF) return 0;
+
+    uint32_t range = 1000; // Base range in meters
+
     // Spreading factor increases range exponentially
-    float sfMultiplier = pow(2, (params.sf - 7) * 0.5f);
-    
+    range = (range * pgm_read_word(&sfRangeQ8[params.sf - 6])) >> 8;
+
     // Bandwidth affects sensitivity (lower BW = better sensitivity)
-    float bwMultiplier = sqrt(125E3 / params.bw);
-    
+    range = (range * pgm_read_word(&bwRangeQ8[bwIndex])) >> 8;
+
     // TX power affects range
-    float powerMultiplier = pow(10, (params.tp - 14) / 20.0f);
-    
-    return baseRange * sfMultiplier * bwMultiplier * powerMultiplier;
-}
+    range = (range * pgm_read_word(&tpRangeQ8[params.tp - 2])) >> 8;
 
+    return range;
+}
@@ -1,6 +1,21 @@
+#ifndef CONFIG_MANAGER_H
+#define CONFIG_MANAGER_H
+
+#include <stdint.h>
 #include "lora_params.h"
 #include "thresholds.h"
 
+// ----- Persistent Storage Configuration -----
+#ifndef CONFIG_STORE_ADDRESS
+#define CONFIG_STORE_ADDRESS 0    // First EEPROM byte used by the config ring
+#endif
+
+#ifndef CONFIG_STORE_SLOTS
+#define CONFIG_STORE_SLOTS 8      // Ring size; each save moves to the next slot (wear levelling)
+#endif
+
+#define CONFIG_STORE_VERSION 1    // Bump when LoraParams/Thresholds layout changes
+
 class ConfigManager{
     private:
         LoraParams param;
@@ -12,19 +27,17 @@ class ConfigManager{
         bool validateParams(const LoraParams& params);
         bool validateThresholds(const Thresholds& thresholds);
         
+        // EEPROM ring: newest valid slot (highest sequence, good CRC) wins at boot
+        uint8_t storeSlot;
+        uint32_t storeSequence;
+        bool loadStored();
+        void saveStored();
+        
     public:
-        ConfigManager(){
-            param.tp = 17;
-            param.sf = 7;
-            param.cr = 5;
-            param.pl = 8;
-            param.sw = 0x12;
-            param.fr = 865E6;  // 865 MHz for India
-            param.bw = 125E3;
-        }
+        ConfigManager();  // Restores persisted config, falls back to defaults
         
         // Existing functions - optimized with references
-        LoraParams getOptimalParamsForRange(float range);
+        LoraParams getOptimalParamsForRange(uint32_t range);  // Range in meters
         void setParams(const LoraParams& p);
         const LoraParams& getParams() const;  // Return by const reference
         void setThresholds(const Thresholds& th);
@@ -32,5 +45,7 @@ class ConfigManager{
         
         // Additional function declarations
         void resetToDefaults();
-        float calculateRange(const LoraParams& params);
-};
\ No newline at end of file
+        uint32_t calculateRange(const LoraParams& params);  // Estimated range in meters
+};
+
+#endif
@@ -1,24 +1,9 @@
 #include "Arduino.h"
-
-// Alert bit definitions for 16-bit alert code
-#define ALERT_NONE                0x0000
-#define ALERT_LOW_TEMP            0x0001
-#define ALERT_HIGH_TEMP           0x0002
-#define ALERT_LOW_HUMIDITY        0x0004
-#define ALERT_HIGH_HUMIDITY       0x0008
-#define ALERT_LOW_SOIL_MOISTURE   0x0010
-#define ALERT_HIGH_SOIL_MOISTURE  0x0020
-#define ALERT_LOW_BATTERY         0x0040
-#define ALERT_SENSOR_FAILURE      0x0080
-#define ALERT_COMM_FAILURE        0x0100
-#define ALERT_CONFIG_ERROR        0x0200
-#define ALERT_LOW_SIGNAL          0x0400
-#define ALERT_MULTIPLE            0x0800
-// Reserved bits: 0x1000, 0x2000, 0x4000, 0x8000 for future use
+#include "alert_codes.h"
 
 class AlertColor {
 private:
-  static const uint8_t NUM_BASE_ALERTS = 13;
+  static const uint8_t NUM_BASE_ALERTS = 14;
   static const uint8_t NUM_COMBO_ALERTS = 15;
   
   // Base alert colors for individual alert types
@@ -42,6 +27,9 @@ public:
       return;
     }
     
+    // Forecasts get one colour of their own, never a measured alert's or combination's
+    if (alertCode & ALERT_PREDICTED) alertCode = ALERT_PREDICTED;
+    
     // First check for predefined agricultural combinations
     for (uint8_t i = 0; i < NUM_COMBO_ALERTS; i++) {
       uint16_t combo = pgm_read_word(&comboAlerts[i]);
@@ -75,8 +63,12 @@ public:
       return;
     }
     
+    // Forecasts are prefixed and never named after a measured combination
+    bool predicted = (alertCode & ALERT_PREDICTED) && (alertCode != ALERT_PREDICTED);
+    if (predicted) alertCode &= ~ALERT_PREDICTED;
+    
     // First check for predefined agricultural combinations
-    for (uint8_t i = 0; i < NUM_COMBO_ALERTS; i++) {
+    for (uint8_t i = 0; i < NUM_COMBO_ALERTS && !predicted; i++) {
       uint16_t combo = pgm_read_word(&comboAlerts[i]);
       if ((alertCode & combo) == combo) {  // Exact match for the combination
         strncpy_P(buffer, comboDescriptions[i], len);
@@ -87,6 +79,7 @@ public:
     
     // If no combination matches, build description from individual alerts
     buffer[0] = '\0';
+    if (predicted) strncat(buffer, "Predicted: ", len - 1);
     uint8_t alertCount = 0;
     
     for (uint8_t i = 0; i < NUM_BASE_ALERTS; i++) {
@@ -147,6 +140,7 @@ const char AlertColor::baseColors[AlertColor::NUM_BASE_ALERTS][8] PROGMEM = {
   "#A0522D", // ALERT_LOW_SOIL_MOISTURE - Sienna
   "#9932CC", // ALERT_LOW_SIGNAL        - DarkOrchid
   "#800080", // ALERT_MULTIPLE          - Purple
+  "#FFD700", // ALERT_PREDICTED         - Gold (below every measured alert)
   "#000000"  // ALERT_NONE              - Black (lowest priority)
 };
 
@@ -163,6 +157,7 @@ const char AlertColor::baseDescriptions[AlertColor::NUM_BASE_ALERTS][20] PROGMEM
   "Low Soil Moisture",
   "Low Signal",
   "Multiple Alerts",
+  "Predicted",
   "No Alert"
 };
 
@@ -179,6 +174,7 @@ const uint16_t AlertColor::alertPriority[AlertColor::NUM_BASE_ALERTS] PROGMEM =
   ALERT_LOW_SOIL_MOISTURE,
   ALERT_LOW_SIGNAL,
   ALERT_MULTIPLE,
+  ALERT_PREDICTED,
   ALERT_NONE
 };
 
@@ -3,11 +3,18 @@
 // Define the DHT sensor object here (not in header)
 DHT dht(DHTPIN, DHTTYPE);
 
+// DHT library only exposes float readings; convert once here so everything
+// downstream (packing, threshold checks) stays in integer 0.1 units
+static int16_t toFixed(float value) {
+    if (isnan(value)) return SENSOR_INVALID;
+    return (int16_t)(value * SENSOR_SCALE + (value < 0 ? -0.5f : 0.5f));
+}
+
 void get_sensor_data(SensorData& data) {
-    data.temperature = dht.readTemperature();     // °C
-    data.humidity = dht.readHumidity();           // %
-    int rawSoil = analogRead(SOIL_PIN);           // 10-bit value: 0–1023
-    data.soilMoisture = 1023.0f - rawSoil;        // Inverted raw ADC value (0-1023)
+    data.temperature = toFixed(dht.readTemperature()); // 0.1 °C
+    data.humidity = toFixed(dht.readHumidity());       // 0.1 %
+    int rawSoil = analogRead(SOIL_PIN);                // 10-bit value: 0–1023
+    data.soilMoisture = 1023 - rawSoil;                // Inverted raw ADC value (0-1023)
     // Note: Soil moisture kept as raw ADC value for compression efficiency
     // Will be converted to percentage at central node for user display
-}
\ No newline at end of file
+}
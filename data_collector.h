@@ -1,3 +1,6 @@
+#ifndef DATA_COLLECTOR_H
+#define DATA_COLLECTOR_H
+
 #include "Arduino.h"
 #include "sensor_data.h"
 #include "DHT.h"
@@ -8,4 +11,6 @@
 
 extern DHT dht; // Declare external DHT object (defined in .cpp)
 
-void get_sensor_data(SensorData& data);  // Modified to take reference parameter
\ No newline at end of file
+void get_sensor_data(SensorData& data);  // Modified to take reference parameter
+
+#endif
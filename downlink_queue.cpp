@@ -0,0 +1,107 @@
+#include "downlink_queue.h"
+
+DownlinkQueue::DownlinkQueue() {
+    for (uint8_t i = 0; i < DOWNLINK_MAX_NODES; i++) {
+        entries[i].used = false;
+    }
+}
+
+DownlinkQueue::Entry* DownlinkQueue::findEntry(uint8_t address, bool create) {
+    Entry* freeEntry = nullptr;
+    for (uint8_t i = 0; i < DOWNLINK_MAX_NODES; i++) {
+        if (entries[i].used && entries[i].address == address) return &entries[i];
+        if (!entries[i].used && !freeEntry) freeEntry = &entries[i];
+    }
+    if (!create || !freeEntry) return nullptr;
+
+    freeEntry->used = true;
+    freeEntry->address = address;
+    freeEntry->hasPending = false;
+    freeEntry->pending = DownlinkBatch();
+    freeEntry->inFlightSequence = 0;
+    return freeEntry;
+}
+
+bool DownlinkQueue::queueParams(uint8_t address, const LoraParams& params) {
+    uint16_t profile = radioProfileEncode(params);
+    if (profile == RADIO_PROFILE_INVALID) return false;  // Node could not decode it
+    Entry* entry = findEntry(address, true);
+    if (!entry) return false;
+    entry->hasPending = true;
+    entry->pending.hasParams = true;
+    entry->pending.profile = profile;
+    entry->pending.tp = (uint8_t)params.tp;
+    entry->pending.sw = (uint8_t)params.sw;
+    return true;
+}
+
+bool DownlinkQueue::queueThresholds(uint8_t address, const Thresholds& thresholds) {
+    Entry* entry = findEntry(address, true);
+    if (!entry) return false;
+    entry->hasPending = true;
+    entry->pending.hasThresholds = true;
+    entry->pending.thresholds = thresholds;
+    return true;
+}
+
+bool DownlinkQueue::queueFail(uint8_t address) {
+    Entry* entry = findEntry(address, true);
+    if (!entry) return false;
+    entry->hasPending = true;
+    entry->pending.sendFail = true;
+    return true;
+}
+
+bool DownlinkQueue::queueInterval(uint8_t address, uint16_t seconds) {
+    Entry* entry = findEntry(address, true);
+    if (!entry) return false;
+    entry->hasPending = true;
+    entry->pending.hasInterval = true;
+    entry->pending.intervalSeconds = seconds;
+    return true;
+}
+
+bool DownlinkQueue::queuedInterval(uint8_t address, uint16_t& seconds) const {
+    for (uint8_t i = 0; i < DOWNLINK_MAX_NODES; i++) {
+        const Entry& entry = entries[i];
+        if (!entry.used || entry.address != address) continue;
+        if (entry.hasPending && entry.pending.hasInterval) {
+            seconds = entry.pending.intervalSeconds;
+            return true;
+        }
+        if (entry.inFlightSequence != 0 && entry.inFlight.hasInterval) {
+            seconds = entry.inFlight.intervalSeconds;
+            return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+bool DownlinkQueue::peek(uint8_t address, uint8_t applied, DownlinkBatch& batch, uint8_t& sequence) {
+    Entry* entry = findEntry(address, false);
+    if (!entry) return false;
+
+    if (entry->inFlightSequence == 0) {
+        if (!entry->hasPending) return false;
+        // Freeze what is queued now; later commands wait for the next batch
+        entry->inFlight = entry->pending;
+        entry->pending = DownlinkBatch();
+        entry->hasPending = false;
+        entry->inFlightSequence = (applied == 255) ? 1 : applied + 1;  // 0 means "no ack"
+    }
+
+    batch = entry->inFlight;
+    sequence = entry->inFlightSequence;
+    return true;
+}
+
+bool DownlinkQueue::acknowledge(uint8_t address, uint8_t sequence, DownlinkBatch& delivered) {
+    Entry* entry = findEntry(address, false);
+    if (!entry || sequence == 0 || entry->inFlightSequence != sequence) return false;
+
+    delivered = entry->inFlight;
+    entry->inFlightSequence = 0;
+    if (!entry->hasPending) entry->used = false;
+    return true;
+}
@@ -0,0 +1,51 @@
+#ifndef DOWNLINK_QUEUE_H
+#define DOWNLINK_QUEUE_H
+
+#include <stdint.h>
+#include "lora_sender.h"
+#include "node_limits.h"
+
+#ifndef DOWNLINK_MAX_NODES
+#define DOWNLINK_MAX_NODES CENTRAL_MAX_NODES  // Nodes with downlinks pending at the same time
+#endif
+
+// Central-node store of downlinks waiting for each node's next RX window.
+// Commands of the same type coalesce (newest wins), so a node only ever
+// receives one BATCH frame per uplink. A sent batch stays in flight and is
+// resent after every uplink until the node echoes its sequence number back.
+// Every uplink reports the last sequence the node applied, and each new batch
+// is numbered one past it, so a batch never reuses that value, even after a
+// central reboot or many batches to other nodes.
+class DownlinkQueue {
+private:
+    struct Entry {
+        bool used;
+        uint8_t address;
+        bool hasPending;
+        DownlinkBatch pending;     // Queued since the in-flight batch was built
+        uint8_t inFlightSequence;  // 0 when nothing awaits an ack
+        DownlinkBatch inFlight;
+    };
+
+    Entry entries[DOWNLINK_MAX_NODES];
+
+    Entry* findEntry(uint8_t address, bool create);
+
+public:
+    DownlinkQueue();
+
+    bool queueParams(uint8_t address, const LoraParams& params);  // False if not in the profile table
+    bool queueThresholds(uint8_t address, const Thresholds& thresholds);
+    bool queueFail(uint8_t address);
+    bool queueInterval(uint8_t address, uint16_t seconds);
+
+    // Newest INTERVAL queued or in flight for the node; false if none
+    bool queuedInterval(uint8_t address, uint16_t& seconds) const;
+    // Batch to send in the node's RX window: the unacked one, else everything queued.
+    // 'applied' is the sequence the node reported in the uplink that opened the window.
+    bool peek(uint8_t address, uint8_t applied, DownlinkBatch& batch, uint8_t& sequence);
+    // Node applied 'sequence': hand back what it confirmed and stop resending it
+    bool acknowledge(uint8_t address, uint8_t sequence, DownlinkBatch& delivered);
+};
+
+#endif
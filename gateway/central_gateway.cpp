@@ -0,0 +1,93 @@
+#include "central_gateway.h"
+#include "lora_receiver.h"
+
+#define GATEWAY_RX_TIMEOUT_MS 50
+
+CentralGateway::CentralGateway(const std::vector<RadioFrontEnd*>& radios, unsigned workers,
+                               const Thresholds& defaultThresholds, uint8_t localAddress)
+    : radios(radios), running(false), framesProcessed(0), framesDropped(0),
+      localAddress(localAddress), pool(workers) {
+    for (unsigned s = 0; s < GATEWAY_SHARDS; s++) {
+        for (unsigned n = 0; n < GATEWAY_NODES_PER_SHARD; n++) {
+            NodeState& node = shards[s].nodes[n];
+            node = NodeState();
+            node.thresholds = defaultThresholds;
+        }
+    }
+}
+
+CentralGateway::~CentralGateway() {
+    stop();
+}
+
+void CentralGateway::start() {
+    if (running.exchange(true)) return;
+    for (unsigned i = 0; i < radios.size(); i++) {
+        receivers.emplace_back(&CentralGateway::receiveLoop, this, i);
+    }
+}
+
+void CentralGateway::stop() {
+    running = false;
+    for (std::thread& t : receivers) t.join();
+    receivers.clear();
+    pool.waitIdle();
+}
+
+void CentralGateway::waitUntilDrained() {
+    for (std::thread& t : receivers) t.join();
+    receivers.clear();
+    running = false;
+    pool.waitIdle();
+}
+
+void CentralGateway::receiveLoop(unsigned radioIndex) {
+    RadioFrontEnd* radio = radios[radioIndex];
+    while (running && !radio->exhausted()) {
+        RadioFrame frame;
+        if (!radio->receiveFrame(frame, GATEWAY_RX_TIMEOUT_MS)) continue;
+        // Home each radio on its own worker; idle workers steal the overflow
+        pool.submit([this, frame] { processFrame(frame); }, radioIndex);
+    }
+}
+
+void CentralGateway::processFrame(const RadioFrame& frame) {
+    LoraReceiver receiver;
+    uint16_t words[RADIO_MAX_FRAME / 2];
+    PayloadData payload = receiver.parseFrame(frame.bytes, frame.length, localAddress, words, sizeof(words) / sizeof(words[0]));
+    if (!payload.data || receiver.getMessageType() != LoraReceiver::DATA) {
+        framesDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Decode outside the shard lock; only the per-node update is serialised
+    SensorData data;
+    receiver.decodeData(payload, data);
+    uint8_t address = receiver.getSenderAddress();
+
+    Shard& shard = shards[address % GATEWAY_SHARDS];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        NodeState& node = shard.nodes[address / GATEWAY_SHARDS];
+        node.seen = true;
+        node.data = data;
+        node.alertCode = evaluateThresholds(data, node.thresholds);
+        node.frames++;
+        node.snr = frame.snr;
+        node.rssi = frame.rssi;
+        node.radio = frame.radio;
+    }
+    framesProcessed.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CentralGateway::setThresholds(uint8_t nodeAddress, const Thresholds& th) {
+    Shard& shard = shards[nodeAddress % GATEWAY_SHARDS];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.nodes[nodeAddress / GATEWAY_SHARDS].thresholds = th;
+}
+
+NodeState CentralGateway::getNodeState(uint8_t nodeAddress) {
+    Shard& shard = shards[nodeAddress % GATEWAY_SHARDS];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.nodes[nodeAddress / GATEWAY_SHARDS];
+}
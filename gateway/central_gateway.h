@@ -0,0 +1,70 @@
+#ifndef CENTRAL_GATEWAY_H
+#define CENTRAL_GATEWAY_H
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "radio_frontend.h"
+#include "work_stealing_pool.h"
+#include "sensor_data.h"
+#include "thresholds.h"
+#include "alert_codes.h"
+
+#ifndef GATEWAY_SHARDS
+#define GATEWAY_SHARDS 16   // Per-node state locks; node address % GATEWAY_SHARDS
+#endif
+
+#define GATEWAY_NODES_PER_SHARD (256 / GATEWAY_SHARDS)
+
+// Latest known state of one field node, as seen by the gateway
+struct NodeState {
+    bool seen;
+    SensorData data;
+    Thresholds thresholds;
+    uint16_t alertCode;
+    uint32_t frames;
+    float snr;
+    int rssi;
+    uint8_t radio;          // Front-end that heard the last uplink
+};
+
+// Multi-radio central gateway.
+// One receive thread per radio front-end hands frames to a work-stealing pool
+// that decodes them, evaluates thresholds and updates sharded per-node state.
+class CentralGateway {
+private:
+    struct Shard {
+        std::mutex mutex;
+        NodeState nodes[GATEWAY_NODES_PER_SHARD];
+    };
+
+    std::vector<RadioFrontEnd*> radios;
+    Shard shards[GATEWAY_SHARDS];
+    std::vector<std::thread> receivers;
+    std::atomic<bool> running;
+    std::atomic<uint32_t> framesProcessed;
+    std::atomic<uint32_t> framesDropped;
+    const uint8_t localAddress;
+    WorkStealingPool pool;   // Declared last: workers are joined before the shards go away
+
+    void receiveLoop(unsigned radioIndex);
+    void processFrame(const RadioFrame& frame);
+
+public:
+    CentralGateway(const std::vector<RadioFrontEnd*>& radios, unsigned workers,
+                   const Thresholds& defaultThresholds, uint8_t localAddress = 0x01);
+    ~CentralGateway();
+
+    void start();
+    void stop();            // Stop receive threads and drain the pool
+    void waitUntilDrained(); // Wait for exhausted front-ends and finish all decodes
+
+    void setThresholds(uint8_t nodeAddress, const Thresholds& th);
+    NodeState getNodeState(uint8_t nodeAddress);
+    uint32_t getFramesProcessed() const { return framesProcessed.load(); }
+    uint32_t getFramesDropped() const { return framesDropped.load(); }
+};
+
+#endif
@@ -0,0 +1,133 @@
+// Fixed-point vs. float pipeline: ns/op for the per-uplink kernels changed by the
+// fixed-point rework, against the float code it replaced (reproduced below).
+// Usage: fixed_point_bench [iterations]
+//
+// The host has an FPU, so these ratios understate the gap on an AVR, where every
+// float operation is a soft-float library call. Flash size is only meaningful
+// from the AVR build (avr-size on the sketch's .elf), not from this binary.
+#include "lora_receiver.h"
+#include "config_manager.h"
+#include "alert_codes.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#define BENCH_SAMPLES 1024
+
+// ----- Float baseline (pre fixed-point SensorData/Thresholds/calculateRange) -----
+// Kept out of line like the firmware versions, which live in other translation units.
+#define BENCH_NOINLINE __attribute__((noinline))
+
+struct FloatSensorData {
+    float temperature;
+    float humidity;
+    float soilMoisture;
+};
+
+struct FloatThresholds {
+    float lowTemperature;
+    float highTemperature;
+    float lowHumidity;
+    float highHumidity;
+    float lowSoilMoisture;
+    float highSoilMoisture;
+};
+
+BENCH_NOINLINE static void decodeDataFloat(const PayloadData& payload, FloatSensorData& data) {
+    if (payload.size < 2) return;
+    uint32_t compressedMessage = ((uint32_t)payload.data[1] << 16) | payload.data[0];
+    data.temperature = compressedMessage & 0x7FF;
+    data.humidity = (compressedMessage >> 11) & 0x3FF;
+    data.soilMoisture = (compressedMessage >> 21) & 0x3FF;
+    data.temperature = (data.temperature - 400) / 10.0f;
+    data.humidity = data.humidity / 10.0f;
+}
+
+BENCH_NOINLINE static uint16_t evaluateThresholdsFloat(const FloatSensorData& data, const FloatThresholds& th) {
+    uint16_t alertCode = ALERT_NONE;
+    if (data.temperature < th.lowTemperature) alertCode |= ALERT_LOW_TEMP;
+    else if (data.temperature > th.highTemperature) alertCode |= ALERT_HIGH_TEMP;
+    if (data.humidity < th.lowHumidity) alertCode |= ALERT_LOW_HUMIDITY;
+    else if (data.humidity > th.highHumidity) alertCode |= ALERT_HIGH_HUMIDITY;
+    if (data.soilMoisture < th.lowSoilMoisture) alertCode |= ALERT_LOW_SOIL_MOISTURE;
+    else if (data.soilMoisture > th.highSoilMoisture) alertCode |= ALERT_HIGH_SOIL_MOISTURE;
+    return alertCode;
+}
+
+BENCH_NOINLINE static float calculateRangeFloat(const LoraParams& params) {
+    float baseRange = 1000.0f;
+    float sfMultiplier = pow(2, (params.sf - 7) * 0.5f);
+    float bwMultiplier = sqrt(125E3 / params.bw);
+    float powerMultiplier = pow(10, (params.tp - 14) / 20.0f);
+    return baseRange * sfMultiplier * bwMultiplier * powerMultiplier;
+}
+
+// ----- Harness -----
+template <typename Kernel>
+static double nsPerOp(uint32_t iterations, Kernel kernel) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) kernel(i % BENCH_SAMPLES);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds * 1e9 / iterations;
+}
+
+static void report(const char* name, double floatNs, double fixedNs) {
+    printf("%-22s %10.2f %10.2f %8.2fx\n", name, floatNs, fixedNs, floatNs / fixedNs);
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = argc > 1 ? (uint32_t)atol(argv[1]) : 20000000;
+    if (iterations == 0) iterations = 1;
+
+    // Same DATA frames and link settings for both variants
+    static uint16_t words[BENCH_SAMPLES][2];
+    static LoraParams params[BENCH_SAMPLES];
+    srand(1);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        uint32_t temperature = 300 + rand() % 500;   // -10.0 .. 39.9 C, offset by 40 C
+        uint32_t humidity = rand() % 1000;
+        uint32_t soil = rand() % 1024;
+        uint32_t packed = (soil << 21) | (humidity << 11) | temperature;
+        words[i][0] = (uint16_t)(packed & 0xFFFF);
+        words[i][1] = (uint16_t)(packed >> 16);
+
+        params[i].sf = 7 + rand() % 6;
+        params[i].tp = 2 + rand() % 19;
+        params[i].bw = (long)radioBandwidths[rand() % RADIO_NUM_BW];
+    }
+
+    ConfigManager configManager;  // Host EEPROM starts erased: default thresholds
+    const Thresholds& th = configManager.getThresholds();
+    FloatThresholds floatTh = {th.lowTemperature / 10.0f, th.highTemperature / 10.0f,
+                               th.lowHumidity / 10.0f, th.highHumidity / 10.0f,
+                               (float)th.lowSoilMoisture, (float)th.highSoilMoisture};
+    LoraReceiver receiver;
+    volatile uint32_t sink = 0;
+
+    double floatDecode = nsPerOp(iterations, [&](uint32_t i) {
+        PayloadData payload = {words[i], 2};
+        FloatSensorData data;
+        decodeDataFloat(payload, data);
+        sink = sink + evaluateThresholdsFloat(data, floatTh);
+    });
+    double fixedDecode = nsPerOp(iterations, [&](uint32_t i) {
+        PayloadData payload = {words[i], 2};
+        SensorData data;
+        receiver.decodeData(payload, data);
+        sink = sink + evaluateThresholds(data, th);
+    });
+
+    double floatRange = nsPerOp(iterations, [&](uint32_t i) {
+        sink = sink + (uint32_t)calculateRangeFloat(params[i]);
+    });
+    double fixedRange = nsPerOp(iterations, [&](uint32_t i) {
+        sink = sink + configManager.calculateRange(params[i]);
+    });
+
+    printf("iterations=%u (host ns/op; see header for AVR caveats)\n", iterations);
+    printf("%-22s %10s %10s %9s\n", "kernel", "float", "fixed", "speedup");
+    report("decode+thresholds", floatDecode, fixedDecode);
+    report("calculateRange", floatRange, fixedRange);
+    return sink == 0xFFFFFFFF;  // Keeps the results observable
+}
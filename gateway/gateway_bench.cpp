@@ -0,0 +1,54 @@
+// Gateway throughput driver: frames/s decoded vs. number of pool workers.
+// Usage: gateway_bench [radios] [frames] [max_workers]
+#include "central_gateway.h"
+#include "simulated_radio.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+#define BENCH_NODES 64
+
+int main(int argc, char** argv) {
+    unsigned radioCount = argc > 1 ? (unsigned)atoi(argv[1]) : 4;
+    uint32_t frames = argc > 2 ? (uint32_t)atol(argv[2]) : 2000000;
+    unsigned maxWorkers = argc > 3 ? (unsigned)atoi(argv[3]) : radioCount;
+    if (radioCount == 0) radioCount = 1;
+    if (maxWorkers == 0) maxWorkers = 1;
+
+    uint8_t nodes[BENCH_NODES];
+    for (uint8_t i = 0; i < BENCH_NODES; i++) nodes[i] = 0x02 + i;
+
+    Thresholds th;
+    th.lowTemperature = 50;
+    th.highTemperature = 350;
+    th.lowHumidity = 300;
+    th.highHumidity = 800;
+    th.lowSoilMoisture = 200;
+    th.highSoilMoisture = 800;
+
+    printf("radios=%u frames=%u hardware_threads=%u\n", radioCount, frames, std::thread::hardware_concurrency());
+    printf("%8s %14s %10s %8s\n", "workers", "frames/s", "speedup", "dropped");
+
+    double baseline = 0.0;
+    for (unsigned workers = 1; workers <= maxWorkers; workers++) {
+        std::vector<std::unique_ptr<SimulatedRadio>> sims;
+        std::vector<RadioFrontEnd*> radios;
+        for (unsigned r = 0; r < radioCount; r++) {
+            sims.emplace_back(new SimulatedRadio(r, 0x01, nodes, BENCH_NODES, frames / radioCount));
+            radios.push_back(sims.back().get());
+        }
+
+        CentralGateway gateway(radios, workers, th);
+        auto start = std::chrono::steady_clock::now();
+        gateway.start();
+        gateway.waitUntilDrained();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        double rate = gateway.getFramesProcessed() / seconds;
+        if (workers == 1) baseline = rate;
+        printf("%8u %14.0f %9.2fx %8u\n", workers, rate, rate / baseline, gateway.getFramesDropped());
+    }
+    return 0;
+}
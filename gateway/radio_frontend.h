@@ -0,0 +1,27 @@
+#ifndef RADIO_FRONTEND_H
+#define RADIO_FRONTEND_H
+
+#include <stdint.h>
+
+#define RADIO_MAX_FRAME 255  // LoRa maximum PHY payload
+
+// One frame as delivered by a concentrator / radio front-end
+struct RadioFrame {
+    uint8_t radio;                    // Index of the front-end that received it
+    uint8_t length;
+    uint8_t bytes[RADIO_MAX_FRAME];   // [Type, To, From, payload...]
+    float snr;
+    int rssi;
+};
+
+// Gateway-side radio abstraction: one receive thread is run per front-end
+class RadioFrontEnd {
+public:
+    virtual ~RadioFrontEnd() {}
+    // Block up to timeoutMs for a frame; false on timeout
+    virtual bool receiveFrame(RadioFrame& frame, uint32_t timeoutMs) = 0;
+    // True once the front-end will never deliver another frame
+    virtual bool exhausted() const { return false; }
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef GATEWAY_SHIM_ARDUINO_H
+#define GATEWAY_SHIM_ARDUINO_H
+
+// Minimal Arduino core surface needed to build the shared protocol code on the host gateway
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+typedef uint8_t byte;
+
+// Host has a flat address space: PROGMEM data is ordinary const data
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define strncpy_P strncpy
+
+unsigned long millis();
+void delay(unsigned long ms);
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef GATEWAY_SHIM_EEPROM_H
+#define GATEWAY_SHIM_EEPROM_H
+
+#include <string.h>
+
+// Host stand-in for the Arduino EEPROM library: 1 KB in RAM (ATmega328P size),
+// erased (0xFF) at start, so ConfigManager boots on its defaults.
+class EEPROMClass {
+public:
+    EEPROMClass() { memset(bytes, 0xFF, sizeof(bytes)); }
+
+    template <typename T> T& get(int address, T& value) {
+        memcpy((void*)&value, bytes + address, sizeof(T));
+        return value;
+    }
+    template <typename T> const T& put(int address, const T& value) {
+        memcpy(bytes + address, (const void*)&value, sizeof(T));
+        return value;
+    }
+    int length() const { return (int)sizeof(bytes); }
+
+private:
+    unsigned char bytes[1024];
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
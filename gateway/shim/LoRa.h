@@ -0,0 +1,20 @@
+#ifndef GATEWAY_SHIM_LORA_H
+#define GATEWAY_SHIM_LORA_H
+
+#include "Arduino.h"
+
+// Host stand-in for the Arduino LoRa library. The gateway receives through
+// RadioFrontEnd implementations; this only satisfies the shared receiver/sender code.
+class LoRaClass {
+public:
+    int begin(long frequency);
+    int parsePacket(int size = 0);
+    int read();
+    float packetSnr();
+    int packetRssi();
+    int beginPacket(int implicitHeader = 0);
+    int endPacket(bool async = false);
+    size_t write(uint8_t b);
+};
+
+#endif
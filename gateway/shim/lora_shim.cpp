@@ -0,0 +1,26 @@
+#include "LoRa.h"
+#include "EEPROM.h"
+#include <chrono>
+#include <thread>
+
+EEPROMClass EEPROM;
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+int LoRaClass::begin(long frequency) { (void)frequency; return 1; }
+int LoRaClass::parsePacket(int size) { (void)size; return 0; }  // No on-board radio: nothing to parse
+int LoRaClass::read() { return -1; }
+float LoRaClass::packetSnr() { return 0.0f; }
+int LoRaClass::packetRssi() { return 0; }
+int LoRaClass::beginPacket(int implicitHeader) { (void)implicitHeader; return 1; }
+int LoRaClass::endPacket(bool async) { (void)async; return 0; }
+size_t LoRaClass::write(uint8_t b) { (void)b; return 0; }
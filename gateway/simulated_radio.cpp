@@ -0,0 +1,45 @@
+#include "simulated_radio.h"
+#include "lora_receiver.h"
+#include <random>
+
+SimulatedRadio::SimulatedRadio(uint8_t radioIndex, uint8_t gatewayAddress, const uint8_t* nodes, uint8_t nodeCount, uint32_t frames)
+    : next(0), remaining(nodeCount ? frames : 0) {
+    if (nodeCount == 0) return;
+
+    std::mt19937 rng(radioIndex + 1);
+    std::uniform_int_distribution<int> node(0, nodeCount - 1);
+    std::uniform_int_distribution<int> temperature(0, 450);   // 0.0 - 45.0 °C
+    std::uniform_int_distribution<int> humidity(100, 1000);   // 10.0 - 100.0 %
+    std::uniform_int_distribution<int> soil(0, 1023);
+    std::uniform_int_distribution<int> snr(-20, 10);
+
+    ring.resize(SIMULATED_RADIO_RING);
+    for (RadioFrame& frame : ring) {
+        // Same layout as LoraSender::sendData
+        uint32_t compressedMessage = ((uint32_t)soil(rng) << 21) |
+                                     ((uint32_t)humidity(rng) << 11) |
+                                     (uint32_t)(temperature(rng) + 400);
+
+        frame.radio = radioIndex;
+        frame.bytes[0] = LoraReceiver::DATA;
+        frame.bytes[1] = gatewayAddress;
+        frame.bytes[2] = nodes[node(rng)];
+        frame.bytes[3] = (uint8_t)(compressedMessage & 0xFF);
+        frame.bytes[4] = (uint8_t)((compressedMessage >> 8) & 0xFF);
+        frame.bytes[5] = (uint8_t)((compressedMessage >> 16) & 0xFF);
+        frame.bytes[6] = (uint8_t)((compressedMessage >> 24) & 0xFF);
+        frame.length = 7;
+        frame.snr = (float)snr(rng);
+        frame.rssi = -120 + snr(rng);
+    }
+}
+
+bool SimulatedRadio::receiveFrame(RadioFrame& frame, uint32_t timeoutMs) {
+    (void)timeoutMs;
+    if (remaining == 0) return false;
+    remaining--;
+
+    frame = ring[next];
+    next = (next + 1) % ring.size();
+    return true;
+}
@@ -0,0 +1,88 @@
+#include "work_stealing_pool.h"
+
+WorkStealingPool::WorkStealingPool(unsigned workers)
+    : nextQueue(0), queued(0), outstanding(0), running(true) {
+    if (workers == 0) workers = 1;
+    for (unsigned i = 0; i < workers; i++) {
+        queues.emplace_back(new Queue());
+    }
+    for (unsigned i = 0; i < workers; i++) {
+        threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        running = false;
+    }
+    wake.notify_all();
+    for (std::thread& t : threads) t.join();
+}
+
+void WorkStealingPool::submit(Task task) {
+    submit(std::move(task), nextQueue.fetch_add(1, std::memory_order_relaxed));
+}
+
+void WorkStealingPool::submit(Task task, unsigned home) {
+    // Count first so a worker can never see a task it was not told about
+    outstanding.fetch_add(1);
+    queued.fetch_add(1);
+    {
+        Queue& q = *queues[home % queues.size()];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+    }
+    wake.notify_one();
+}
+
+void WorkStealingPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    idle.wait(lock, [this] { return outstanding.load() == 0; });
+}
+
+bool WorkStealingPool::popLocal(unsigned index, Task& task) {
+    Queue& q = *queues[index];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.tasks.empty()) return false;
+    task = std::move(q.tasks.back());
+    q.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(unsigned index, Task& task) {
+    for (unsigned i = 1; i < queues.size(); i++) {
+        Queue& q = *queues[(index + i) % queues.size()];
+        std::unique_lock<std::mutex> lock(q.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || q.tasks.empty()) continue;
+        task = std::move(q.tasks.front());
+        q.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(unsigned index) {
+    Task task;
+    for (;;) {
+        if (popLocal(index, task) || steal(index, task)) {
+            queued.fetch_sub(1);
+            task();
+            task = nullptr;
+            if (outstanding.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                idle.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        if (!running && queued.load() == 0) return;
+        // Short timeout covers a task that was skipped by a contended try_lock steal
+        wake.wait_for(lock, std::chrono::milliseconds(1),
+                      [this] { return !running || queued.load() > 0; });
+    }
+}
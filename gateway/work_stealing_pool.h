@@ -0,0 +1,49 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size thread pool for the gateway.
+// Each worker owns a deque: it pops its own tasks LIFO (cache-warm) and, when
+// empty, steals FIFO from the other workers so bursts on one radio spread out.
+class WorkStealingPool {
+public:
+    typedef std::function<void()> Task;
+
+    explicit WorkStealingPool(unsigned workers);
+    ~WorkStealingPool();
+
+    void submit(Task task);                  // Round-robin over worker queues
+    void submit(Task task, unsigned home);   // Prefer worker 'home % size()'
+    void waitIdle();                         // Block until every submitted task has run
+    unsigned size() const { return (unsigned)queues.size(); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+    std::atomic<unsigned> nextQueue;
+    std::atomic<size_t> queued;        // Tasks sitting in a deque
+    std::atomic<size_t> outstanding;   // Tasks submitted but not yet finished
+    std::atomic<bool> running;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+
+    bool popLocal(unsigned index, Task& task);
+    bool steal(unsigned index, Task& task);
+    void workerLoop(unsigned index);
+};
+
+#endif
@@ -1,6 +1,7 @@
 #include "local_node.h"
 #include "lora_receiver.h"
 #include "data_collector.h"  // For get_sensor_data() function
+#include "adr_engine.h"      // TX power limits shared with the central's ADR
 #include <exception>
 
 const byte LocalNode::getDestinationAddress(){
@@ -8,11 +9,58 @@ const byte LocalNode::getDestinationAddress(){
     return destination_addresses[i++ % size_da];
 }
 
+void LocalNode::applyParams(){
+    const LoraParams& params = configManager.getParams();
+    lora.setFrequency(params.fr);
+    lora.setSpreadingFactor(params.sf);
+    lora.setSignalBandwidth(params.bw);
+    lora.setCodingRate4(params.cr);
+    lora.setTxPower(params.tp);
+    lora.setPreambleLength(params.pl);
+    lora.setSyncWord(params.sw);
+    if (params.crc) lora.enableCrc();
+    else lora.disableCrc();
+}
+
+uint32_t LocalNode::rxWindowMs(){
+    // Long enough to catch the preamble and the largest BATCH frame at current settings
+    const LoraParams& params = configManager.getParams();
+    uint32_t symbolUs = ((uint32_t)1 << params.sf) * 1000000UL / params.bw;
+    uint16_t payloadSymbols = 8 + ((8 * DOWNLINK_MAX_FRAME + 44 - 1) / (4 * params.sf)) * params.cr;
+    return (symbolUs * (params.pl + 5 + payloadSymbols)) / 1000 + 2 * DOWNLINK_RX_SLACK_MS;
+}
+
+bool LocalNode::openReceiveWindow(){
+    // Radio sleeps between uplink and window, and after it, instead of sitting in RX
+    unsigned long txEnd = millis();
+    lora.sleep();
+    unsigned long opensAt = DOWNLINK_RX1_DELAY_MS - DOWNLINK_RX_SLACK_MS;
+    unsigned long elapsed = millis() - txEnd;
+    if (elapsed < opensAt) delay(opensAt - elapsed);
+
+    uint32_t windowMs = rxWindowMs();
+    unsigned long windowStart = millis();
+    bool received = false;
+    while (!received && millis() - windowStart < windowMs) {
+        // Peer uplinks addressed to us may land here too; only the central's BATCH closes the window
+        received = receiveMessage() && receiver.getMessageType() == LoraReceiver::BATCH;
+    }
+    lora.sleep();
+    return received;
+}
+
 bool LocalNode::sendMessage(){
     try{
         get_sensor_data(sensorData);
         destination_address = getDestinationAddress();
-        sender.sendData(sensorData, localAddress, destination_address, lora);
+        if (destination_address != CENTRAL_ADDRESS) {
+            sender.sendData(sensorData, localAddress, destination_address, lora);
+            return true;
+        }
+
+        // Only the central queues downlinks: report the last batch applied and listen for the next one
+        sender.sendData(sensorData, localAddress, destination_address, lora, lastBatchSequence);
+        openReceiveWindow();
         return true;
     }
     catch(const std::exception& e){
@@ -20,22 +68,13 @@ bool LocalNode::sendMessage(){
     }
 }
 
-bool LocalNode::receiveMessage() {
-    PayloadData message = receiver.receiveMessage(localAddress, lora);
-    if (!message.data) return false;
-
-    LoraReceiver::MessageType messageType = receiver.getMessageType();
-    if (messageType == LoraReceiver::NONE) return false;  // Fixed: added return statement
-
+void LocalNode::handleCommand(LoraReceiver::MessageType messageType, const PayloadData& message) {
     switch (messageType) {
-        case LoraReceiver::DATA:
-            // Ignored by local node
-            break;
-
         case LoraReceiver::CONFIG: {
-            LoraParams params;
+            LoraParams params = configManager.getParams();  // Keeps fields CONFIG does not carry
             receiver.decodeParams(message, params);
             configManager.setParams(params);
+            applyParams();  // Central ADR may have moved this node to a new SF/TP
             break;
         }
 
@@ -47,15 +86,54 @@ bool LocalNode::receiveMessage() {
         }
 
         case LoraReceiver::SENDFAIL: {
-            range *= 1.1f;
-            LoraParams newParams = configManager.getOptimalParamsForRange(range);
-            configManager.setParams(newParams);
+            // Only TX power: a node moved off the central's SF/BW could no longer be heard
+            LoraParams params = configManager.getParams();
+            if (adrRaisePower(params.tp) == params.tp) break;  // Already at ADR_MAX_TP: spare the EEPROM
+            params.tp = adrRaisePower(params.tp);
+            configManager.setParams(params);
+            applyParams();
+            break;
+        }
+
+        case LoraReceiver::INTERVAL: {
+            uint16_t seconds = receiver.decodeInterval(message);
+            if (seconds > 0) reportInterval = seconds;
             break;
         }
 
         default:
+            // DATA is ignored by local node
             break;
     }
+}
+
+bool LocalNode::receiveMessage() {
+    PayloadData message = receiver.receiveMessage(localAddress, lora);
+    if (!message.data) return false;
+
+    LoraReceiver::MessageType messageType = receiver.getMessageType();
+    if (messageType == LoraReceiver::NONE) return false;  // Fixed: added return statement
+
+    if (messageType == LoraReceiver::BATCH) {
+        if (receiver.getSenderAddress() != CENTRAL_ADDRESS) {  // Sequences belong to the central's queue
+            delete[] message.data;
+            return false;
+        }
+        uint8_t sequence = receiver.decodeBatchSequence(message);
+        // A resent batch (our ack was lost) is only acked again, so SENDFAIL is not applied twice.
+        // The central numbers each batch one past the sequence we report, so a new one always differs.
+        if (sequence != lastBatchSequence) {
+            uint8_t offset = 0;
+            LoraReceiver::MessageType commandType;
+            PayloadData command;
+            while (receiver.nextCommand(message, offset, commandType, command)) {
+                handleCommand(commandType, command);
+            }
+            lastBatchSequence = sequence;
+        }
+    } else {
+        handleCommand(messageType, message);
+    }
 
     delete[] message.data; // only if dynamically allocated
     return true;
@@ -1,3 +1,6 @@
+#ifndef LOCAL_NODE_H
+#define LOCAL_NODE_H
+
 #include "lora_receiver.h"
 #include "lora_sender.h"
 #include "Arduino.h"
@@ -17,18 +20,26 @@ class LocalNode{
         LoraSender sender;
         ConfigManager configManager;
         SensorData sensorData;
-        float range;
+        uint16_t reportInterval;  // Seconds between sendMessage() calls
+        uint8_t lastBatchSequence = 0;  // Last BATCH applied, reported in every uplink to the central
         const byte localAddress = 0x03;
         byte destination_address = 0x01;
+        void applyParams();  // Push ConfigManager params to the radio
+        void handleCommand(LoraReceiver::MessageType messageType, const PayloadData& message);
+        uint32_t rxWindowMs();
+        bool openReceiveWindow();  // RX1 after an uplink to the central, radio asleep otherwise
     public:
-        LocalNode() : receiver(), sender(), configManager() , range(30.f) {
-            lora.begin(865E6); // Initialize LoRa on 865 MHz for India
-            sensorData.temperature = -100.0f;  // Initialize with default values
-            sensorData.humidity = -100.0f;
-            sensorData.soilMoisture = -100.0f;
+        LocalNode() : receiver(), sender(), configManager() , reportInterval(LOCAL_REPORT_INTERVAL_S) {
+            lora.begin(configManager.getParams().fr); // Restored from EEPROM (865 MHz for India by default)
+            applyParams();  // Rejoin on the persisted SF/TP without waiting for a CONFIG push
+            sensorData.temperature = SENSOR_INVALID;  // Initialize with default values
+            sensorData.humidity = SENSOR_INVALID;
+            sensorData.soilMoisture = 0;
         }
         bool sendMessage();
         bool receiveMessage();
         const byte getDestinationAddress();
+        uint16_t getReportInterval() const { return reportInterval; }
 };
 
+#endif
@@ -1,3 +1,6 @@
+#ifndef LORA_PARAMS_H
+#define LORA_PARAMS_H
+
 struct LoraParams {
     // User-configurable parameters
     int tp = -1;       // Transmission power
@@ -13,3 +16,5 @@ struct LoraParams {
     bool invertIQ = false;  // IQ inversion for gateway compatibility
     bool ldro = false;      // Low data rate optimization
 };
+
+#endif
@@ -13,7 +13,7 @@ PayloadData LoraReceiver::receiveMessage(const byte &local_address, LoRaClass &l
 
     // Read message type
     uint8_t typeByte = lora.read();
-    if (typeByte < 1 || typeByte > 4) {
+    if (typeByte < 1 || typeByte > MessageType::INTERVAL) {
         messageType = MessageType::NONE;
         return {nullptr, 0};
     }
@@ -39,6 +39,11 @@ PayloadData LoraReceiver::receiveMessage(const byte &local_address, LoRaClass &l
     
     int payloadWords = payloadBytes / 2;
 
+    // Keep sender and link quality for ADR at the central node
+    senderAddress = sender_address;
+    packetSnr = lora.packetSnr();
+    packetRssi = lora.packetRssi();
+
     // Allocate payload buffer
     uint16_t* payload = new uint16_t[payloadWords];
     for (int i = 0; i < payloadWords; i++) {
@@ -48,36 +53,89 @@ PayloadData LoraReceiver::receiveMessage(const byte &local_address, LoRaClass &l
     return {payload, payloadWords};
 }
 
+PayloadData LoraReceiver::parseFrame(const uint8_t* frame, int length, const byte &local_address, uint16_t* buffer, uint8_t bufferWords) {
+    messageType = MessageType::NONE;
+    if (length < MIN_PACKET) return {nullptr, 0};
+
+    uint8_t typeByte = frame[0];
+    if (typeByte < 1 || typeByte > MessageType::INTERVAL) return {nullptr, 0};
+
+    byte received_address = frame[1];
+    if (received_address != local_address && received_address != BROADCAST_ADDRESS) return {nullptr, 0};
+
+    int payloadBytes = length - 3;
+    if (payloadBytes <= 0 || payloadBytes % 2 != 0 || payloadBytes / 2 > bufferWords) return {nullptr, 0};
+
+    messageType = static_cast<MessageType>(typeByte);
+    senderAddress = frame[2];
+
+    uint8_t payloadWords = payloadBytes / 2;
+    for (uint8_t i = 0; i < payloadWords; i++) {
+        buffer[i] = (uint16_t)frame[3 + 2 * i] | ((uint16_t)frame[4 + 2 * i] << 8);
+    }
+
+    return {buffer, payloadWords};
+}
+
 void LoraReceiver::decodeData(const PayloadData& payload, SensorData& data) {
     if (payload.size < 2) return;
     uint32_t compressedMessage = ((uint32_t)payload.data[1] << 16) | payload.data[0];
-    data.temperature = compressedMessage & 0x7FF;
-    data.humidity = (compressedMessage >> 11) & 0x3FF;
+    uint16_t temperature = compressedMessage & 0x7FF;
+    uint16_t humidity = (compressedMessage >> 11) & 0x3FF;
+    data.temperature = (temperature == 0x7FF) ? SENSOR_INVALID : (int16_t)temperature - 400; // 0.1 °C
+    data.humidity = (humidity == 0x3FF) ? SENSOR_INVALID : (int16_t)humidity;               // 0.1 %
     data.soilMoisture = (compressedMessage >> 21) & 0x3FF;
-    data.temperature = (data.temperature - 400) / 10.0f; // Convert to Celsius
-    data.humidity = data.humidity / 10.0f; // Convert to percentage
     // Keep soil moisture as raw ADC value (0-1023) for now
     // Will be converted to percentage at central node for user display
 }
 
 void LoraReceiver::decodeThresholds(const PayloadData& payload, Thresholds& thresholds) {
     if (payload.size < 6) return;
-    thresholds.lowTemperature = (int16_t)(payload.data[0] & 0x7FF) / 10.0f - 40.0f; // Convert to Celsius
-    thresholds.highTemperature = (int16_t)(payload.data[1] & 0x7FF) / 10.0f - 40.0f; // Convert to Celsius
-    thresholds.lowHumidity = (uint16_t)(payload.data[2] & 0x3FF) / 10.0f; // Convert to percentage
-    thresholds.highHumidity = (uint16_t)(payload.data[3] & 0x3FF) / 10.0f; // Convert to percentage
-    thresholds.lowSoilMoisture = (uint16_t)(payload.data[4] & 0x3FF) / 10.0f; // Convert to raw ADC value
-    thresholds.highSoilMoisture = (uint16_t)(payload.data[5] & 0x3FF) / 10.0f; // Convert to raw ADC value
+    thresholds.lowTemperature = (int16_t)(payload.data[0] & 0x7FF) - 400;  // 0.1 °C
+    thresholds.highTemperature = (int16_t)(payload.data[1] & 0x7FF) - 400; // 0.1 °C
+    thresholds.lowHumidity = (int16_t)(payload.data[2] & 0x3FF);           // 0.1 %
+    thresholds.highHumidity = (int16_t)(payload.data[3] & 0x3FF);          // 0.1 %
+    thresholds.lowSoilMoisture = (int16_t)(payload.data[4] / 10);          // 0.1 ADC counts to raw ADC value
+    thresholds.highSoilMoisture = (int16_t)(payload.data[5] / 10);
 }
 
 void LoraReceiver::decodeParams(const PayloadData& payload, LoraParams& params) {
-    if (payload.size < 5) return; // Minimum size for params
-    params.tp = payload.data[0] & 0xFF; // Transmission power
-    params.sf = payload.data[0] >> 8; // Spreading factor
-    params.cr = payload.data[1] & 0xFF; // Coding rate
+    if (payload.size < CONFIG_WORDS) return; // Minimum size for params
+    if (!radioProfileDecode(payload.data[0], params)) return; // SF, BW, CR and frequency
+    params.tp = payload.data[1] & 0xFF; // Transmission power
     params.sw = payload.data[1] >> 8; // Sync word
-    params.pl = payload.data[2];
-    params.fr = payload.data[3] * 1e6; // Convert MHz to Hz
-    params.bw = payload.data[4] * 1e3; // Convert kHz to Hz
+    // Preamble length is not carried; params keeps the caller's value
+}
+
+uint16_t LoraReceiver::decodeInterval(const PayloadData& payload) {
+    if (payload.size < INTERVAL_WORDS) return 0;
+    return payload.data[0];
+}
+
+uint8_t LoraReceiver::decodeAck(const PayloadData& payload) {
+    if (payload.size <= DATA_ACK_WORD) return 0;
+    return payload.data[DATA_ACK_WORD] & 0xFF;
 }
 
+uint8_t LoraReceiver::decodeBatchSequence(const PayloadData& payload) {
+    if (payload.size < BATCH_HEADER_WORDS) return 0;
+    return payload.data[0] & 0xFF;
+}
+
+bool LoraReceiver::nextCommand(const PayloadData& batch, uint8_t& offset, MessageType& type, PayloadData& command) {
+    if (offset < BATCH_HEADER_WORDS) offset = BATCH_HEADER_WORDS;  // Skip sequence word
+    if (!batch.data || offset >= batch.size) return false;
+
+    uint16_t header = batch.data[offset];
+    uint8_t typeByte = header & 0xFF;
+    uint8_t words = header >> 8;
+    if (typeByte < MessageType::CONFIG || typeByte > MessageType::INTERVAL ||
+        typeByte == MessageType::BATCH) return false;  // No nesting, no uplinks
+    if (offset + 1 + words > batch.size) return false;
+
+    type = static_cast<MessageType>(typeByte);
+    command.data = batch.data + offset + 1;
+    command.size = words;
+    offset += 1 + words;
+    return true;
+}
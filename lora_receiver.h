@@ -6,12 +6,37 @@
 #include "thresholds.h"
 #include "lora_params.h"
 #include "payload_data.h"
+#include "radio_profiles.h"
 #include "LoRa.h"
 
 #ifndef BROADCAST_ADDRESS
 #define BROADCAST_ADDRESS 0xFF
 #endif
 
+#ifndef CENTRAL_ADDRESS
+#define CENTRAL_ADDRESS 0x01        // Only the central node queues downlinks
+#endif
+
+#ifndef LOCAL_REPORT_INTERVAL_S
+#define LOCAL_REPORT_INTERVAL_S 600  // Default uplink interval; central may shorten it per node
+#endif
+
+// Payload sizes (16-bit words) of commands that can be carried in a BATCH frame
+#define CONFIG_WORDS 2          // [profile index][TP | SW << 8]
+#define THRESHOLDS_WORDS 6
+#define INTERVAL_WORDS 1
+#define BATCH_HEADER_WORDS 1    // [sequence | reserved << 8], echoed back in DATA uplinks
+#define DATA_ACK_WORD 2         // Optional third DATA word: sequence of the last BATCH applied (sent in every uplink once nonzero)
+
+// ----- Downlink receive window (class-A style) -----
+// Central node answers an uplink DOWNLINK_RX1_DELAY_MS after receiving it and
+// the local node listens only then. Unacknowledged batches are resent after the next uplink.
+#ifndef DOWNLINK_RX1_DELAY_MS
+#define DOWNLINK_RX1_DELAY_MS 1000
+#endif
+#define DOWNLINK_RX_SLACK_MS 20     // Window opens this early to absorb clock drift
+#define DOWNLINK_MAX_FRAME 31       // Header + sequence + CONFIG + THRESHOLDS + SENDFAIL + INTERVAL commands
+
 class LoraReceiver {
 public:
     // Scoped and type-safe enum
@@ -20,19 +45,34 @@ public:
         DATA,
         CONFIG,
         THRESHOLDS,
-        SENDFAIL
+        SENDFAIL,   // Raise TX power one step (SF/BW are left alone)
+        BATCH,      // Several coalesced downlink commands in one frame
+        INTERVAL    // New reporting interval (seconds) for a local node
     };
 
 private:
     MessageType messageType = NONE;
+    byte senderAddress = 0;
+    float packetSnr = 0.0f;   // Link quality of the last accepted packet
+    int packetRssi = 0;
 
 public:
     PayloadData receiveMessage(const byte &localAddress, LoRaClass &lora);
+    // Parse a frame already read off the air (gateway front-ends); payload words go into caller's buffer
+    PayloadData parseFrame(const uint8_t* frame, int length, const byte &localAddress, uint16_t* buffer, uint8_t bufferWords);
     MessageType getMessageType() const { return messageType; }
+    byte getSenderAddress() const { return senderAddress; }
+    float getPacketSnr() const { return packetSnr; }
+    int getPacketRssi() const { return packetRssi; }
     void decodeData(const PayloadData& payload, SensorData& data);      // Use reference parameter
     void decodeThresholds(const PayloadData& payload, Thresholds& th);  // Use reference parameter
-    void decodeParams(const PayloadData& payload, LoraParams& params);  // Use reference parameter
+    void decodeParams(const PayloadData& payload, LoraParams& params);  // Updates only fields carried by CONFIG
     bool decodeFail(const PayloadData& payload);
+    uint16_t decodeInterval(const PayloadData& payload);  // Seconds, 0 if malformed
+    uint8_t decodeAck(const PayloadData& payload);        // BATCH sequence acked by a DATA uplink, 0 if none
+    uint8_t decodeBatchSequence(const PayloadData& payload);
+    // Walk the commands of a BATCH payload; 'offset' starts at 0 and is advanced on each call
+    bool nextCommand(const PayloadData& batch, uint8_t& offset, MessageType& type, PayloadData& command);
 };
 
 #endif
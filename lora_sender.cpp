@@ -1,56 +1,58 @@
 #include "lora_sender.h"
 
-bool LoraSender::sendData(const SensorData& data, const byte &sender_address, const byte &receiver_address, LoRaClass &lora) {
+bool LoraSender::sendData(const SensorData& data, const byte &sender_address, const byte &receiver_address, LoRaClass &lora, uint8_t downlinkAck) {
     lora.beginPacket();
     lora.write((uint8_t)LoraReceiver::MessageType::DATA);
     lora.write(receiver_address);
     lora.write(sender_address);
 
-    uint32_t compressedMessage = ((uint32_t)(data.soilMoisture * 1023.0f / 100.0f) << 21) |
-                                    ((uint32_t)(data.humidity * 10.0f) << 11) |
-                                    (uint32_t)(data.temperature * 10.0f + 400);
+    // Integer packing of 0.1-unit readings: [soil:10][humidity:10][temperature+40C:11]
+    // All-ones field marks an invalid reading (out of the sensor's physical range)
+    uint32_t temperature = (data.temperature == SENSOR_INVALID) ? 0x7FF : (uint32_t)(data.temperature + 400) & 0x7FF;
+    uint32_t humidity = (data.humidity == SENSOR_INVALID) ? 0x3FF : (uint32_t)data.humidity & 0x3FF;
+    uint32_t soilMoisture = (uint32_t)data.soilMoisture & 0x3FF;
+    uint32_t compressedMessage = (soilMoisture << 21) | (humidity << 11) | temperature;
     lora.write((uint8_t)(compressedMessage & 0xFF));
     lora.write((uint8_t)((compressedMessage >> 8) & 0xFF));
     lora.write((uint8_t)((compressedMessage >> 16) & 0xFF));
     lora.write((uint8_t)((compressedMessage >> 24) & 0xFF));
 
+    // Acknowledge the last BATCH applied; omitted when there is nothing to ack
+    if (downlinkAck != 0) {
+        lora.write(downlinkAck);
+        lora.write((uint8_t)0);
+    }
+
     return lora.endPacket() > 0;
 }
 
+void LoraSender::writeParams(uint16_t profile, uint8_t tp, uint8_t sw, LoRaClass &lora) {
+    lora.write((uint8_t)(profile & 0xFF)); // SF x BW x CR x channel, exact (no MHz/kHz truncation)
+    lora.write((uint8_t)((profile >> 8) & 0xFF));
+    lora.write(tp);
+    lora.write(sw);
+}
+
 bool LoraSender::sendConfig(const LoraParams& params, const byte &sender_address, const byte &receiver_address, LoRaClass &lora) {
+    uint16_t profile = radioProfileEncode(params);
+    if (profile == RADIO_PROFILE_INVALID) return false;  // Not representable: receiver would drop it
+
     lora.beginPacket();
     lora.write((uint8_t)LoraReceiver::MessageType::CONFIG);
     lora.write(receiver_address);
     lora.write(sender_address);
-    uint16_t fr = (uint16_t)(params.fr / 1e6); // Convert frequency to MHz
-    uint16_t bw = (uint16_t)(params.bw / 1e3); // Convert bandwidth to kHz
-
-    lora.write((uint8_t)params.tp);
-    lora.write((uint8_t)params.sf);
-    lora.write((uint8_t)params.cr);
-    lora.write((uint8_t)params.sw);
-    lora.write((uint8_t)(params.pl & 0xFF));
-    lora.write((uint8_t)((params.pl >> 8) & 0xFF));
-    lora.write((uint8_t)(fr & 0xFF));
-    lora.write((uint8_t)((fr >> 8) & 0xFF));
-    lora.write((uint8_t)(bw & 0xFF));
-    lora.write((uint8_t)((bw >> 8) & 0xFF));
+    writeParams(profile, (uint8_t)params.tp, (uint8_t)params.sw, lora);
     
     return lora.endPacket() > 0;
 }
 
-bool LoraSender::sendThresholds(const Thresholds& thresholds, const byte &sender_address, const byte &receiver_address, LoRaClass &lora) {
-    lora.beginPacket();
-    lora.write((uint8_t)LoraReceiver::MessageType::THRESHOLDS);
-    lora.write(receiver_address);
-    lora.write(sender_address);
-
-    uint16_t lowTemp = (int16_t)(thresholds.lowTemperature * 10.0f + 400);
-    uint16_t highTemp = (int16_t)(thresholds.highTemperature * 10.0f + 400);
-    uint16_t lowHumidity = (uint16_t)(thresholds.lowHumidity * 10.0f);
-    uint16_t highHumidity = (uint16_t)(thresholds.highHumidity * 10.0f);
-    uint16_t lowSoilMoisture = (uint16_t)(thresholds.lowSoilMoisture * 10.0f);
-    uint16_t highSoilMoisture = (uint16_t)(thresholds.highSoilMoisture * 10.0f);
+void LoraSender::writeThresholds(const Thresholds& thresholds, LoRaClass &lora) {
+    uint16_t lowTemp = (uint16_t)(thresholds.lowTemperature + 400);
+    uint16_t highTemp = (uint16_t)(thresholds.highTemperature + 400);
+    uint16_t lowHumidity = (uint16_t)thresholds.lowHumidity;
+    uint16_t highHumidity = (uint16_t)thresholds.highHumidity;
+    uint16_t lowSoilMoisture = (uint16_t)(thresholds.lowSoilMoisture * 10);   // Wire carries 0.1 ADC counts
+    uint16_t highSoilMoisture = (uint16_t)(thresholds.highSoilMoisture * 10);
 
     lora.write((uint8_t)(lowTemp & 0xFF));
     lora.write((uint8_t)((lowTemp >> 8) & 0xFF));
@@ -64,6 +66,14 @@ bool LoraSender::sendThresholds(const Thresholds& thresholds, const byte &sender
     lora.write((uint8_t)((lowSoilMoisture >> 8) & 0xFF));
     lora.write((uint8_t)(highSoilMoisture & 0xFF));
     lora.write((uint8_t)((highSoilMoisture >> 8) & 0xFF));
+}
+
+bool LoraSender::sendThresholds(const Thresholds& thresholds, const byte &sender_address, const byte &receiver_address, LoRaClass &lora) {
+    lora.beginPacket();
+    lora.write((uint8_t)LoraReceiver::MessageType::THRESHOLDS);
+    lora.write(receiver_address);
+    lora.write(sender_address);
+    writeThresholds(thresholds, lora);
 
     return lora.endPacket() > 0;
 }
@@ -76,3 +86,40 @@ bool LoraSender::sendFail(const byte &sender_address, const byte &receiver_addre
 
     return lora.endPacket() > 0;
 }
+
+bool LoraSender::sendBatch(const DownlinkBatch& batch, uint8_t sequence, const byte &sender_address, const byte &receiver_address, LoRaClass &lora) {
+    // DownlinkQueue only stores encodable params; still never put an invalid index on air
+    bool sendParams = batch.hasParams && batch.profile != RADIO_PROFILE_INVALID;
+    if (!sendParams && !batch.hasThresholds && !batch.sendFail && !batch.hasInterval) return false;
+
+    lora.beginPacket();
+    lora.write((uint8_t)LoraReceiver::MessageType::BATCH);
+    lora.write(receiver_address);
+    lora.write(sender_address);
+    lora.write(sequence);
+    lora.write((uint8_t)0);
+
+    // Each command: header word [type][payload words], then its usual payload
+    if (sendParams) {
+        lora.write((uint8_t)LoraReceiver::MessageType::CONFIG);
+        lora.write((uint8_t)CONFIG_WORDS);
+        writeParams(batch.profile, batch.tp, batch.sw, lora);
+    }
+    if (batch.hasThresholds) {
+        lora.write((uint8_t)LoraReceiver::MessageType::THRESHOLDS);
+        lora.write((uint8_t)THRESHOLDS_WORDS);
+        writeThresholds(batch.thresholds, lora);
+    }
+    if (batch.sendFail) {
+        lora.write((uint8_t)LoraReceiver::MessageType::SENDFAIL);
+        lora.write((uint8_t)0);
+    }
+    if (batch.hasInterval) {
+        lora.write((uint8_t)LoraReceiver::MessageType::INTERVAL);
+        lora.write((uint8_t)INTERVAL_WORDS);
+        lora.write((uint8_t)(batch.intervalSeconds & 0xFF));
+        lora.write((uint8_t)((batch.intervalSeconds >> 8) & 0xFF));
+    }
+
+    return lora.endPacket() > 0;
+}
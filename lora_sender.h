@@ -1,9 +1,33 @@
+#ifndef LORA_SENDER_H
+#define LORA_SENDER_H
+
 #include "lora_receiver.h"
 
+// Downlinks pending for one node, coalesced into a single BATCH frame.
+// CONFIG is kept in its wire form (profile index, TP, sync word) rather than a
+// whole LoraParams, since the central holds two of these per tracked node.
+struct DownlinkBatch {
+    bool hasParams = false;
+    uint16_t profile = RADIO_PROFILE_INVALID;  // radioProfileEncode() of SF/BW/CR/channel
+    uint8_t tp = 0;
+    uint8_t sw = 0;
+    bool hasThresholds = false;
+    Thresholds thresholds;
+    bool sendFail = false;
+    bool hasInterval = false;
+    uint16_t intervalSeconds = 0;
+};
+
 class LoraSender{
+    private:
+        void writeParams(uint16_t profile, uint8_t tp, uint8_t sw, LoRaClass &lora);
+        void writeThresholds(const Thresholds& thresholds, LoRaClass &lora);
     public:
-        bool sendData(const SensorData& data, const byte &sender_address, const byte &receiver_address, LoRaClass &lora);
+        bool sendData(const SensorData& data, const byte &sender_address, const byte &receiver_address, LoRaClass &lora, uint8_t downlinkAck = 0);
         bool sendConfig(const LoraParams& params, const byte &sender_address, const byte &receiver_address, LoRaClass &lora);
         bool sendThresholds(const Thresholds& thresholds, const byte &sender_address, const byte &receiver_address, LoRaClass &lora);
         bool sendFail(const byte &sender_address, const byte &receiver_address, LoRaClass &lora);
-};
\ No newline at end of file
+        bool sendBatch(const DownlinkBatch& batch, uint8_t sequence, const byte &sender_address, const byte &receiver_address, LoRaClass &lora);
+};
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef NODE_LIMITS_H
+#define NODE_LIMITS_H
+
+// Nodes the central node keeps state for in each of its per-node tables
+// (AdrEngine, DownlinkQueue, TrendEstimator). Together they cost about
+// 130 bytes per node, so a 2 KB ATmega328P-class central tracks 4 nodes.
+#ifndef CENTRAL_MAX_NODES
+#if defined(__AVR__)
+#include <avr/io.h>
+#if RAMEND < 0x900              // 2 KB SRAM (ATmega328P class)
+#define CENTRAL_MAX_NODES 4
+#else
+#define CENTRAL_MAX_NODES 16
+#endif
+#else
+#define CENTRAL_MAX_NODES 16
+#endif
+#endif
+
+#endif
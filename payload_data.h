@@ -1,4 +1,9 @@
+#ifndef PAYLOAD_DATA_H
+#define PAYLOAD_DATA_H
+
 struct PayloadData {
     uint16_t* data;
     uint8_t size;
-};
\ No newline at end of file
+};
+
+#endif
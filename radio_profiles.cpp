@@ -0,0 +1,49 @@
+#include "radio_profiles.h"
+
+// Supported bandwidths (Hz), in SX127x register order
+const uint32_t radioBandwidths[RADIO_NUM_BW] PROGMEM = {
+    7800, 10400, 15600, 20800, 31250, 41700, 62500, 125000, 250000
+};
+
+// Supported channels (Hz): IN865 default channels first, then whole-MHz ISM channels
+const uint32_t radioChannels[RADIO_NUM_CHANNELS] PROGMEM = {
+    865062500, 865402500, 865985000,
+    865000000, 866000000, 867000000, 868000000,
+    433000000, 915000000
+};
+
+uint8_t radioBandwidthIndex(long bw) {
+    for (uint8_t i = 0; i < RADIO_NUM_BW; i++) {
+        if ((long)pgm_read_dword(&radioBandwidths[i]) == bw) return i;
+    }
+    return 0xFF;
+}
+
+uint8_t radioChannelIndex(long fr) {
+    for (uint8_t i = 0; i < RADIO_NUM_CHANNELS; i++) {
+        if ((long)pgm_read_dword(&radioChannels[i]) == fr) return i;
+    }
+    return 0xFF;
+}
+
+uint16_t radioProfileEncode(const LoraParams& params) {
+    if (params.sf < RADIO_MIN_SF || params.sf >= RADIO_MIN_SF + RADIO_NUM_SF) return RADIO_PROFILE_INVALID;
+    if (params.cr < RADIO_MIN_CR || params.cr >= RADIO_MIN_CR + RADIO_NUM_CR) return RADIO_PROFILE_INVALID;
+    uint8_t bw = radioBandwidthIndex(params.bw);
+    uint8_t channel = radioChannelIndex(params.fr);
+    if (bw == 0xFF || channel == 0xFF) return RADIO_PROFILE_INVALID;
+
+    return ((uint16_t)(channel * RADIO_NUM_BW + bw) * RADIO_NUM_SF + (params.sf - RADIO_MIN_SF)) * RADIO_NUM_CR +
+           (params.cr - RADIO_MIN_CR);
+}
+
+bool radioProfileDecode(uint16_t index, LoraParams& params) {
+    if (index >= RADIO_NUM_PROFILES) return false;
+    params.cr = RADIO_MIN_CR + index % RADIO_NUM_CR;
+    index /= RADIO_NUM_CR;
+    params.sf = RADIO_MIN_SF + index % RADIO_NUM_SF;
+    index /= RADIO_NUM_SF;
+    params.bw = (long)pgm_read_dword(&radioBandwidths[index % RADIO_NUM_BW]);
+    params.fr = (long)pgm_read_dword(&radioChannels[index / RADIO_NUM_BW]);
+    return true;
+}
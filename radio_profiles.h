@@ -0,0 +1,34 @@
+#ifndef RADIO_PROFILES_H
+#define RADIO_PROFILES_H
+
+#include <stdint.h>
+#include "Arduino.h"
+#include "lora_params.h"
+
+// Shared radio-profile table (central and local nodes must be built from the same copy).
+// A profile is SF x BW x CR x channel; CONFIG frames carry its 16-bit index
+// instead of raw values, so sub-kHz bandwidths and channels round-trip exactly.
+//   index = ((channel * RADIO_NUM_BW + bw) * RADIO_NUM_SF + sf) * RADIO_NUM_CR + cr
+
+#define RADIO_MIN_SF 6
+#define RADIO_NUM_SF 7              // SF6..SF12
+#define RADIO_MIN_CR 5
+#define RADIO_NUM_CR 4              // 4/5..4/8
+#define RADIO_NUM_BW 9
+#define RADIO_NUM_CHANNELS 9
+#define RADIO_NUM_PROFILES (RADIO_NUM_CHANNELS * RADIO_NUM_BW * RADIO_NUM_SF * RADIO_NUM_CR)
+#define RADIO_PROFILE_INVALID 0xFFFF
+
+extern const uint32_t radioBandwidths[RADIO_NUM_BW] PROGMEM;        // Hz, in SX127x register order
+extern const uint32_t radioChannels[RADIO_NUM_CHANNELS] PROGMEM;    // Hz
+
+uint8_t radioBandwidthIndex(long bw);    // Index into radioBandwidths[], or 0xFF if unsupported
+uint8_t radioChannelIndex(long fr);      // Index into radioChannels[], or 0xFF if unsupported
+
+// Profile index of params' SF/BW/CR/frequency, or RADIO_PROFILE_INVALID if not in the table
+uint16_t radioProfileEncode(const LoraParams& params);
+
+// Fill SF/BW/CR/frequency from a profile index; other fields are left untouched
+bool radioProfileDecode(uint16_t index, LoraParams& params);
+
+#endif
@@ -1,7 +1,18 @@
+#ifndef SENSOR_DATA_H
+#define SENSOR_DATA_H
+
+#include <stdint.h>
+
+// Fixed-point representation keeps sensor paths free of soft-float (AVR has no FPU)
+#define SENSOR_SCALE 10           // Temperature/humidity stored in 0.1 units
+#define SENSOR_INVALID INT16_MIN  // Reading failed (e.g. DHT timeout)
+
 struct SensorData {
-    float temperature;  // Temperature in degrees Celsius
-    float humidity;     // Humidity in percentage
-    float soilMoisture; // Soil moisture as raw ADC value (0-1023)
+    int16_t temperature;  // Temperature in 0.1 degrees Celsius
+    int16_t humidity;     // Humidity in 0.1 percent
+    int16_t soilMoisture; // Soil moisture as raw ADC value (0-1023)
     // Note: soilMoisture kept as raw value for compression efficiency
     // Will be converted to percentage at central node for display
-};
\ No newline at end of file
+};
+
+#endif
@@ -1,8 +1,16 @@
+#ifndef THRESHOLDS_H
+#define THRESHOLDS_H
+
+#include <stdint.h>
+
+// Same fixed-point units as SensorData
 struct Thresholds{
-    float lowTemperature;   // Temperature in Celsius
-    float highTemperature;  // Temperature in Celsius
-    float lowHumidity;      // Humidity in percentage
-    float highHumidity;     // Humidity in percentage
-    float lowSoilMoisture;  // Soil moisture as raw ADC value (0-1023)
-    float highSoilMoisture; // Soil moisture as raw ADC value (0-1023)
-};
\ No newline at end of file
+    int16_t lowTemperature;   // Temperature in 0.1 degrees Celsius
+    int16_t highTemperature;  // Temperature in 0.1 degrees Celsius
+    int16_t lowHumidity;      // Humidity in 0.1 percent
+    int16_t highHumidity;     // Humidity in 0.1 percent
+    int16_t lowSoilMoisture;  // Soil moisture as raw ADC value (0-1023)
+    int16_t highSoilMoisture; // Soil moisture as raw ADC value (0-1023)
+};
+
+#endif
@@ -0,0 +1,150 @@
+#include "trend_estimator.h"
+#include "alert_codes.h"
+#include <string.h>
+
+TrendEstimator::TrendEstimator() {
+    memset(nodes, 0, sizeof(nodes));
+}
+
+TrendEstimator::NodeTrend* TrendEstimator::findNode(uint8_t address, bool create) {
+    NodeTrend* freeSlot = nullptr;
+    for (uint8_t i = 0; i < TREND_MAX_NODES; i++) {
+        if (nodes[i].used && nodes[i].address == address) return &nodes[i];
+        if (!nodes[i].used && !freeSlot) freeSlot = &nodes[i];
+    }
+    if (!create || !freeSlot) return nullptr;
+
+    memset(freeSlot, 0, sizeof(NodeTrend));
+    freeSlot->used = true;
+    freeSlot->address = address;
+    return freeSlot;
+}
+
+const TrendEstimator::NodeTrend* TrendEstimator::findNode(uint8_t address) const {
+    for (uint8_t i = 0; i < TREND_MAX_NODES; i++) {
+        if (nodes[i].used && nodes[i].address == address) return &nodes[i];
+    }
+    return nullptr;
+}
+
+void TrendEstimator::updateSeries(Series& s, int16_t value, uint32_t dt) {
+    if (value == SENSOR_INVALID) return;
+
+    if (s.samples == 0 || dt == 0) {
+        if (s.samples == 0) s.level = (int32_t)value * 256;
+        if (s.samples < 255) s.samples++;
+        return;
+    }
+    if (dt > TREND_MAX_DT_S) dt = TREND_MAX_DT_S;
+
+    // Holt's linear method for irregular sample spacing; |slope * dt| < 2^27 by the clamps
+    int32_t predicted = s.level + s.slope * (int32_t)dt / 256;
+    int32_t residual = (int32_t)value * 256 - predicted;
+    int32_t previousLevel = s.level;
+    s.level = predicted + residual * TREND_ALPHA_Q8 / 256;
+
+    int32_t step = s.level - previousLevel;
+    if (step > (1L << 22)) step = 1L << 22;  // Keeps step * 256 in range; beyond any real sensor
+    if (step < -(1L << 22)) step = -(1L << 22);
+    int32_t observed = step * 256 / (int32_t)dt;
+    if (observed > TREND_MAX_SLOPE_Q16) observed = TREND_MAX_SLOPE_Q16;
+    if (observed < -TREND_MAX_SLOPE_Q16) observed = -TREND_MAX_SLOPE_Q16;
+    s.slope += (observed - s.slope) * TREND_BETA_Q8 / 256;
+
+    int32_t magnitude = residual < 0 ? -residual : residual;
+    if (magnitude > (1L << 22)) magnitude = 1L << 22;
+    s.deviation += (magnitude - s.deviation) * TREND_ALPHA_Q8 / 256;
+    if (s.samples < 255) s.samples++;
+}
+
+int16_t TrendEstimator::secondsToGap(int32_t gap, int32_t slope) {
+    // gap (Q8) / slope (Q16 per s) = gap * 256 / slope seconds, split to stay within int32
+    int32_t whole = gap / slope;
+    if (whole >= 128) return INT16_MAX;  // Beyond any horizon
+    return (int16_t)(whole * 256 + (gap % slope) * 256 / slope);
+}
+
+void TrendEstimator::forecast(Series& s, int16_t value, int16_t low, int16_t high) {
+    s.secondsToLow = -1;
+    s.secondsToHigh = -1;
+    if (s.samples < TREND_WARMUP) return;
+    if (value != SENSOR_INVALID && (value < low || value > high)) return;  // Already a real alert
+
+    // Widen the forecast by the residual spread so noisy series alert earlier
+    int32_t band = s.deviation + s.deviation / 4;
+    if (s.slope > 0) {
+        int32_t gap = (int32_t)high * 256 - (s.level + band);
+        s.secondsToHigh = gap > 0 ? secondsToGap(gap, s.slope) : 0;
+    } else if (s.slope < 0) {
+        int32_t gap = (s.level - band) - (int32_t)low * 256;
+        s.secondsToLow = gap > 0 ? secondsToGap(gap, -s.slope) : 0;
+    }
+}
+
+uint16_t TrendEstimator::update(uint8_t address, const SensorData& data, const Thresholds& th, unsigned long nowMs) {
+    NodeTrend* node = findNode(address, true);
+    if (!node) return ALERT_NONE;
+
+    uint32_t dt = node->lastMs ? (nowMs - node->lastMs) / 1000 : 0;
+    node->lastMs = nowMs ? nowMs : 1;
+
+    updateSeries(node->series[TEMPERATURE], data.temperature, dt);
+    updateSeries(node->series[HUMIDITY], data.humidity, dt);
+    updateSeries(node->series[SOIL_MOISTURE], data.soilMoisture, dt);
+
+    forecast(node->series[TEMPERATURE], data.temperature, th.lowTemperature, th.highTemperature);
+    forecast(node->series[HUMIDITY], data.humidity, th.lowHumidity, th.highHumidity);
+    forecast(node->series[SOIL_MOISTURE], data.soilMoisture, th.lowSoilMoisture, th.highSoilMoisture);
+
+    static const uint16_t lowBits[NUM_METRICS] = {ALERT_LOW_TEMP, ALERT_LOW_HUMIDITY, ALERT_LOW_SOIL_MOISTURE};
+    static const uint16_t highBits[NUM_METRICS] = {ALERT_HIGH_TEMP, ALERT_HIGH_HUMIDITY, ALERT_HIGH_SOIL_MOISTURE};
+
+    uint16_t alertCode = ALERT_NONE;
+    bool approaching = false;
+    for (uint8_t m = 0; m < NUM_METRICS; m++) {
+        const Series& s = node->series[m];
+        if (s.secondsToLow >= 0 && s.secondsToLow <= TREND_HORIZON_S) alertCode |= lowBits[m];
+        if (s.secondsToHigh >= 0 && s.secondsToHigh <= TREND_HORIZON_S) alertCode |= highBits[m];
+        if ((s.secondsToLow >= 0 && s.secondsToLow <= TREND_EXIT_HORIZON_S) ||
+            (s.secondsToHigh >= 0 && s.secondsToHigh <= TREND_EXIT_HORIZON_S)) approaching = true;
+    }
+    // A threshold already crossed also holds dense sampling
+    if (evaluateThresholds(data, th) & ~(ALERT_SENSOR_FAILURE)) approaching = true;
+
+    // Hysteresis: enter on a forecast within the horizon, leave only after several calm samples
+    if (alertCode != ALERT_NONE) {
+        node->wantDense = true;
+        node->calmSamples = 0;
+    } else if (approaching) {
+        node->calmSamples = 0;
+    } else if (node->wantDense && ++node->calmSamples >= TREND_EXIT_SAMPLES) {
+        node->wantDense = false;
+        node->calmSamples = 0;
+    }
+
+    if (alertCode != ALERT_NONE) alertCode |= ALERT_PREDICTED;
+    return alertCode;
+}
+
+int16_t TrendEstimator::secondsToCrossing(uint8_t address, Metric metric, bool high) const {
+    const NodeTrend* node = findNode(address);
+    if (!node || metric >= NUM_METRICS) return -1;
+    return high ? node->series[metric].secondsToHigh : node->series[metric].secondsToLow;
+}
+
+bool TrendEstimator::wantsDense(uint8_t address) const {
+    const NodeTrend* node = findNode(address);
+    return node && node->wantDense;
+}
+
+bool TrendEstimator::setDense(uint8_t address, bool dense) {
+    NodeTrend* node = findNode(address, dense);
+    if (!node || node->dense == dense) return false;
+    node->dense = dense;
+    return true;
+}
+
+bool TrendEstimator::isDense(uint8_t address) const {
+    const NodeTrend* node = findNode(address);
+    return node && node->dense;
+}
@@ -0,0 +1,100 @@
+#ifndef TREND_ESTIMATOR_H
+#define TREND_ESTIMATOR_H
+
+#include <stdint.h>
+#include "sensor_data.h"
+#include "thresholds.h"
+#include "node_limits.h"
+
+// ----- Trend Estimator Configuration -----
+#ifndef TREND_MAX_NODES
+#define TREND_MAX_NODES CENTRAL_MAX_NODES
+#endif
+
+#ifndef TREND_HORIZON_S
+#define TREND_HORIZON_S 3600      // Raise an early alert if a crossing is forecast within this time
+#endif
+
+#ifndef TREND_EXIT_HORIZON_S
+#define TREND_EXIT_HORIZON_S (2 * TREND_HORIZON_S)  // Dense sampling holds while a crossing is this close
+#endif
+
+#ifndef TREND_EXIT_SAMPLES
+#define TREND_EXIT_SAMPLES 3      // Consecutive calm samples before dense sampling ends
+#endif
+
+#if TREND_EXIT_HORIZON_S > 32767 || TREND_HORIZON_S > TREND_EXIT_HORIZON_S
+#error "TREND_HORIZON_S <= TREND_EXIT_HORIZON_S <= 32767 required"
+#endif
+
+// Integer Holt smoothing in the sensor's 0.1 units: level and deviation are Q8,
+// slope is Q16 per second. Weights are Q8 (256 = 1.0).
+#define TREND_ALPHA_Q8 77         // Level smoothing, ~0.3 (EWMA weight of the newest sample)
+#define TREND_BETA_Q8 26          // Slope smoothing, ~0.1
+#define TREND_WARMUP 3            // Samples before forecasts are trusted
+#define TREND_MAX_DT_S 2048       // Longer gaps are treated as this long (keeps products in int32)
+#define TREND_MAX_SLOPE_Q16 65536L  // 1.0 unit (0.1 C, 0.1 %RH, 1 ADC count) per second
+
+// Central-node streaming forecaster.
+// Per node and metric it keeps Holt's level/slope plus an EW mean absolute
+// residual (O(1) integer work per sample) and forecasts when each threshold
+// will be crossed. The safety band is 1.25 x that deviation, about one standard
+// deviation for normally distributed residuals, so no square root is needed.
+class TrendEstimator {
+public:
+    enum Metric : uint8_t {
+        TEMPERATURE = 0,
+        HUMIDITY,
+        SOIL_MOISTURE,
+        NUM_METRICS
+    };
+
+private:
+    struct Series {
+        int32_t level;          // Smoothed value, Q8
+        int32_t slope;          // Q16 per second
+        int32_t deviation;      // EW mean absolute one-step forecast residual, Q8
+        int16_t secondsToLow;   // Forecast crossing times, negative if not approaching
+        int16_t secondsToHigh;
+        uint8_t samples;
+    };
+
+    struct NodeTrend {
+        bool used;
+        bool dense;             // Node confirmed reporting at the short interval
+        bool wantDense;         // Forecast asks for the short interval (with hysteresis)
+        uint8_t calmSamples;    // Samples in a row with no crossing within TREND_EXIT_HORIZON_S
+        uint8_t address;
+        unsigned long lastMs;
+        Series series[NUM_METRICS];
+    };
+
+    NodeTrend nodes[TREND_MAX_NODES];
+
+    NodeTrend* findNode(uint8_t address, bool create);
+    const NodeTrend* findNode(uint8_t address) const;
+    static void updateSeries(Series& s, int16_t value, uint32_t dt);
+    static void forecast(Series& s, int16_t value, int16_t low, int16_t high);
+    static int16_t secondsToGap(int32_t gap, int32_t slope);
+
+public:
+    TrendEstimator();
+
+    // Feed one reading; returns ALERT_PREDICTED | bits of thresholds not yet crossed but
+    // forecast to be, or ALERT_NONE. Crossings already happening are left to evaluateThresholds().
+    uint16_t update(uint8_t address, const SensorData& data, const Thresholds& th, unsigned long nowMs);
+
+    // Seconds until the metric is forecast to cross its low/high threshold, negative if not approaching
+    int16_t secondsToCrossing(uint8_t address, Metric metric, bool high) const;
+
+    // Whether the node should report at the short interval. Entered as soon as a crossing is
+    // forecast within TREND_HORIZON_S; left after TREND_EXIT_SAMPLES samples with none
+    // within TREND_EXIT_HORIZON_S, so a flickering forecast does not toggle the interval.
+    bool wantsDense(uint8_t address) const;
+
+    // Record the interval the node acknowledged; true if that changed
+    bool setDense(uint8_t address, bool dense);
+    bool isDense(uint8_t address) const;
+};
+
+#endif